@@ -0,0 +1,23 @@
+// FADD/FSUB with the normal-operand fast path and through the general path
+// (LIBX87_NO_FAST_PATH), in ns/op, on the same random operands.
+
+#include <stdio.h>
+
+#include "bench.h"
+
+volatile uint64_t bench_sink;
+
+extern "C" {
+double bench_addsub_full(const char *op);
+double bench_addsub_fast(const char *op);
+}
+
+int main()
+{
+    static const char *const ops[] = { "add", "sub" };
+
+    printf("%-8s %10s %10s\n", "op", "full", "fast");
+    for (int i = 0; i < 2; i++)
+        printf("%-8s %10.1f %10.1f\n", ops[i], bench_addsub_full(ops[i]), bench_addsub_fast(ops[i]));
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Built once per multi-word arithmetic configuration.  The build renames the
+// libx87 namespace and sets BENCH_ENTRY, so that every copy of softfloat can
+// be linked into the same program.
+
+#include <string>
+
+#include "bench.h"
+#include "softfloat.cpp"
+
+extern "C" double BENCH_ENTRY(const char *op)
+{
+    using namespace libx87;
+
+    static floatx80 a[BENCH_OPERANDS], b[BENCH_OPERANDS];
+    float_status_t status = {};
+    status.float_rounding_precision = 80;
+    status.float_rounding_mode = float_round_nearest_even;
+    status.float_exception_masks = float_all_exceptions_mask;
+
+    std::string name(op);
+    if (name == "fyl2x") {
+        // a in [1, 2), where FYL2X takes its polynomial path
+        bench_operands(a, BENCH_OPERANDS, 0x3FFF, 0, 1);
+        for (int i = 0; i < BENCH_OPERANDS; i++) a[i].exp = 0x3FFF;
+    } else if (name == "fyl2xp1") {
+        // 2^-12 <= |a| < 1/8, where FYL2XP1 takes its polynomial path
+        bench_operands(a, BENCH_OPERANDS, 0x3FF7, 4, 1);
+    } else if (name == "f2xm1") {
+        // 2^-7 <= |a| < 1
+        bench_operands(a, BENCH_OPERANDS, 0x3FFB, 3, 1);
+    } else if (name == "fsincos" || name == "fsin" || name == "fcos" || name == "fptan") {
+        // |a| < 4, reduced by one step at most
+        bench_operands(a, BENCH_OPERANDS, 0x3FFF, 1, 1);
+    } else {
+        bench_operands(a, BENCH_OPERANDS, 0x3FFF, 20, 1);
+    }
+    bench_operands(b, BENCH_OPERANDS, 0x3FFF, 20, 2);
+    if (name == "sqrt")
+        for (int i = 0; i < BENCH_OPERANDS; i++) a[i].exp &= 0x7FFF;
+
+    uint64_t sink = 0;
+    double ns = -1;
+    if (name == "add") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) sink += floatx80_add(a[i], b[i], &status).fraction;
+        });
+    } else if (name == "sub") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) sink += floatx80_sub(a[i], b[i], &status).fraction;
+        });
+    } else if (name == "mul") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) sink += floatx80_mul(a[i], b[i], &status).fraction;
+        });
+    } else if (name == "div") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) sink += floatx80_div(a[i], b[i], &status).fraction;
+        });
+    } else if (name == "sqrt") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) sink += floatx80_sqrt(a[i], &status).fraction;
+        });
+    } else if (name == "fsincos") {
+        ns = bench_ns_per_op([&] {
+            floatx80 s, c;
+            for (int i = 0; i < BENCH_OPERANDS; i++) {
+                fsincos(a[i], &s, &c, &status);
+                sink += s.fraction + c.fraction;
+            }
+        });
+    } else if (name == "fsin") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) {
+                floatx80 z = a[i];
+                fsin(&z, &status);
+                sink += z.fraction;
+            }
+        });
+    } else if (name == "fcos") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) {
+                floatx80 z = a[i];
+                fcos(&z, &status);
+                sink += z.fraction;
+            }
+        });
+    } else if (name == "fptan") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) {
+                floatx80 z = a[i];
+                ftan(&z, &status);
+                sink += z.fraction;
+            }
+        });
+    } else if (name == "f2xm1") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) sink += f2xm1(a[i], &status).fraction;
+        });
+    } else if (name == "fyl2x") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) sink += fyl2x(a[i], b[i], &status).fraction;
+        });
+    } else if (name == "fyl2xp1") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) sink += fyl2xp1(a[i], b[i], &status).fraction;
+        });
+    } else if (name == "fpatan") {
+        ns = bench_ns_per_op([&] {
+            for (int i = 0; i < BENCH_OPERANDS; i++) sink += fpatan(a[i], b[i], &status).fraction;
+        });
+    } else if (name == "fprem") {
+        ns = bench_ns_per_op([&] {
+            floatx80 r;
+            uint64_t q;
+            for (int i = 0; i < BENCH_OPERANDS; i++) {
+                floatx80_remainder(a[i], b[i], &r, &q, &status);
+                sink += r.fraction + q;
+            }
+        });
+    }
+    bench_sink += sink;
+    return ns;
+}
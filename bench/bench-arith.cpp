@@ -0,0 +1,35 @@
+// Latency of the basic arithmetic and of a few transcendentals with the
+// portable 32-bit limb arithmetic (LIBX87_PORTABLE_ARITH) and with the native
+// 128-bit integer arithmetic, in ns/op.
+//
+// usage: bench-arith [op...]
+
+#include <stdio.h>
+
+#include "bench.h"
+
+volatile uint64_t bench_sink;
+
+extern "C" {
+double bench_arith_portable(const char *op);
+double bench_arith_native(const char *op);
+}
+
+int main(int argc, char **argv)
+{
+    static const char *const ops[] = { "add", "mul", "div", "sqrt", "fsincos", "fyl2x", "fpatan", "fprem" };
+
+    printf("%-8s %10s %10s\n", "op", "portable", "native");
+    int n = argc > 1 ? argc - 1 : (int) (sizeof(ops) / sizeof(ops[0]));
+    for (int i = 0; i < n; i++) {
+        const char *op = argc > 1 ? argv[i + 1] : ops[i];
+        double portable = bench_arith_portable(op);
+        double native = bench_arith_native(op);
+        if (portable < 0 || native < 0) {
+            fprintf(stderr, "unknown op %s\n", op);
+            return 1;
+        }
+        printf("%-8s %10.1f %10.1f\n", op, portable, native);
+    }
+    return 0;
+}
@@ -0,0 +1,21 @@
+// F2XM1 with the table-driven 2^x - 1 kernel and with the float128
+// polynomial (LIBX87_NO_TABLE_KERNELS), in ns/op, on the same random
+// operands.
+
+#include <stdio.h>
+
+#include "bench.h"
+
+volatile uint64_t bench_sink;
+
+extern "C" {
+double bench_kernel_poly(const char *op);
+double bench_kernel_table(const char *op);
+}
+
+int main()
+{
+    printf("%-8s %10s %10s\n", "op", "poly", "table");
+    printf("%-8s %10.1f %10.1f\n", "f2xm1", bench_kernel_poly("f2xm1"), bench_kernel_table("f2xm1"));
+    return 0;
+}
@@ -0,0 +1,21 @@
+// FPATAN with the breakpoint-table arctangent and with the float128 division
+// and polynomial (LIBX87_NO_TABLE_KERNELS), in ns/op, on the same random
+// operands.
+
+#include <stdio.h>
+
+#include "bench.h"
+
+volatile uint64_t bench_sink;
+
+extern "C" {
+double bench_kernel_poly(const char *op);
+double bench_kernel_table(const char *op);
+}
+
+int main()
+{
+    printf("%-8s %10s %10s\n", "op", "poly", "table");
+    printf("%-8s %10.1f %10.1f\n", "fpatan", bench_kernel_poly("fpatan"), bench_kernel_table("fpatan"));
+    return 0;
+}
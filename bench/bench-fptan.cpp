@@ -0,0 +1,21 @@
+// FPTAN with the table-driven tangent kernel and with the float128 sine and
+// cosine polynomials (LIBX87_NO_TABLE_KERNELS), in ns/op, on the same random
+// operands.
+
+#include <stdio.h>
+
+#include "bench.h"
+
+volatile uint64_t bench_sink;
+
+extern "C" {
+double bench_kernel_poly(const char *op);
+double bench_kernel_table(const char *op);
+}
+
+int main()
+{
+    printf("%-8s %10s %10s\n", "op", "poly", "table");
+    printf("%-8s %10.1f %10.1f\n", "fptan", bench_kernel_poly("fptan"), bench_kernel_table("fptan"));
+    return 0;
+}
@@ -0,0 +1,24 @@
+// FYL2X/FYL2XP1 with the table-driven log2 kernel and with the float128
+// polynomials (LIBX87_NO_TABLE_KERNELS), in ns/op, on the same random
+// operands.
+
+#include <stdio.h>
+
+#include "bench.h"
+
+volatile uint64_t bench_sink;
+
+extern "C" {
+double bench_kernel_poly(const char *op);
+double bench_kernel_table(const char *op);
+}
+
+int main()
+{
+    static const char *const ops[] = { "fyl2x", "fyl2xp1" };
+
+    printf("%-8s %10s %10s\n", "op", "poly", "table");
+    for (int i = 0; i < 2; i++)
+        printf("%-8s %10.1f %10.1f\n", ops[i], bench_kernel_poly(ops[i]), bench_kernel_table(ops[i]));
+    return 0;
+}
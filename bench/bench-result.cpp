@@ -0,0 +1,85 @@
+// FADD/FSUB/FMUL/FDIV/FSQRT through the status word interface and through
+// the register-returning {result, flags} interface, in ns/op.  Both loops
+// start every operation from clear flags and fold the flags into the sink,
+// as the FPU does.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+
+namespace libx87 {
+#include "libx87/softfloat/softfloat.h"
+}
+
+using namespace libx87;
+
+volatile uint64_t bench_sink;
+
+static floatx80 a[BENCH_OPERANDS], b[BENCH_OPERANDS];
+
+static double bench_status(const char *op, float_status_t status)
+{
+    uint64_t sink = 0;
+    double ns = -1;
+#define BENCH_STATUS_OP(name, expr)                                          \
+    if (strcmp(op, name) == 0)                                               \
+        ns = bench_ns_per_op([&] {                                           \
+            for (int i = 0; i < BENCH_OPERANDS; i++) {                       \
+                status.float_exception_flags = 0;                            \
+                floatx80 z = expr;                                           \
+                sink += z.fraction + status.float_exception_flags;           \
+            }                                                                \
+        });
+    BENCH_STATUS_OP("add", floatx80_add(a[i], b[i], &status))
+    BENCH_STATUS_OP("sub", floatx80_sub(a[i], b[i], &status))
+    BENCH_STATUS_OP("mul", floatx80_mul(a[i], b[i], &status))
+    BENCH_STATUS_OP("div", floatx80_div(a[i], b[i], &status))
+    BENCH_STATUS_OP("sqrt", floatx80_sqrt(a[i], &status))
+#undef BENCH_STATUS_OP
+    bench_sink += sink;
+    return ns;
+}
+
+static double bench_result(const char *op, float_config_t config)
+{
+    uint64_t sink = 0;
+    double ns = -1;
+#define BENCH_RESULT_OP(name, expr)                                          \
+    if (strcmp(op, name) == 0)                                               \
+        ns = bench_ns_per_op([&] {                                           \
+            for (int i = 0; i < BENCH_OPERANDS; i++) {                       \
+                floatx80_result r = expr;                                    \
+                sink += r.fraction + r.flags;                                \
+            }                                                                \
+        });
+    BENCH_RESULT_OP("add", floatx80_add_r(a[i], b[i], config))
+    BENCH_RESULT_OP("sub", floatx80_sub_r(a[i], b[i], config))
+    BENCH_RESULT_OP("mul", floatx80_mul_r(a[i], b[i], config))
+    BENCH_RESULT_OP("div", floatx80_div_r(a[i], b[i], config))
+    BENCH_RESULT_OP("sqrt", floatx80_sqrt_r(a[i], config))
+#undef BENCH_RESULT_OP
+    bench_sink += sink;
+    return ns;
+}
+
+int main()
+{
+    static const char *const ops[] = { "add", "sub", "mul", "div", "sqrt" };
+
+    float_status_t status = {};
+    status.float_rounding_precision = 80;
+    status.float_rounding_mode = float_round_nearest_even;
+    status.float_exception_masks = 0x3F;
+    float_config_t config = float_config_from_status(&status);
+
+    printf("%-8s %10s %10s\n", "op", "status", "result");
+    for (int i = 0; i < 5; i++) {
+        bench_operands(a, BENCH_OPERANDS, 0x3FFF, 20, 1);
+        bench_operands(b, BENCH_OPERANDS, 0x3FFF, 20, 2);
+        if (strcmp(ops[i], "sqrt") == 0)
+            for (int k = 0; k < BENCH_OPERANDS; k++) a[k].exp &= 0x7FFF;
+        printf("%-8s %10.1f %10.1f\n", ops[i], bench_status(ops[i], status), bench_result(ops[i], config));
+    }
+    return 0;
+}
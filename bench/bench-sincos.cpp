@@ -0,0 +1,24 @@
+// FSIN/FCOS/FSINCOS with the table-driven sine and cosine kernel and with the
+// float128 polynomials (LIBX87_NO_TABLE_KERNELS), in ns/op, on the same
+// random operands.
+
+#include <stdio.h>
+
+#include "bench.h"
+
+volatile uint64_t bench_sink;
+
+extern "C" {
+double bench_kernel_poly(const char *op);
+double bench_kernel_table(const char *op);
+}
+
+int main()
+{
+    static const char *const ops[] = { "fsin", "fcos", "fsincos" };
+
+    printf("%-8s %10s %10s\n", "op", "poly", "table");
+    for (int i = 0; i < 3; i++)
+        printf("%-8s %10.1f %10.1f\n", ops[i], bench_kernel_poly(ops[i]), bench_kernel_table(ops[i]));
+    return 0;
+}
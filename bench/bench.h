@@ -0,0 +1,55 @@
+#ifndef LIBX87_BENCH_H_
+#define LIBX87_BENCH_H_
+
+#include <stdint.h>
+#include <chrono>
+#include <random>
+
+// Number of operands (or operand pairs) each benchmark loop walks through
+#define BENCH_OPERANDS 1024
+
+// Folded into by the benchmark loops so that the results are not optimised away
+extern volatile uint64_t bench_sink;
+
+// Fills `x' with normal extended double-precision values of either sign, with
+// exponents in [exp - spread, exp + spread].  Works on any floatx80 layout,
+// whatever namespace the copy of softfloat under test lives in.
+template <typename T>
+void bench_operands(T *x, int n, int exp, int spread, uint64_t seed)
+{
+    std::mt19937_64 rng(seed);
+    for (int i = 0; i < n; i++) {
+        x[i].fraction = rng() | 0x8000000000000000ULL;
+        x[i].exp = (uint16_t) (exp - spread + (int) (rng() % (2 * spread + 1)));
+        if (rng() & 1) x[i].exp |= 0x8000;
+    }
+}
+
+// Best time per operation, in ns, of `loop', which runs one operation on each
+// of the BENCH_OPERANDS operands.  The loop is repeated for about 2 ms per
+// sample and the best of 31 samples is kept, which filters out most of the
+// interference from other processes.
+template <typename F>
+double bench_ns_per_op(F loop)
+{
+    typedef std::chrono::steady_clock clock;
+
+    clock::time_point start = clock::now();
+    loop();
+    double once = std::chrono::duration<double>(clock::now() - start).count();
+    long passes = once > 0 ? (long) (0.002 / once) : 1000;
+    if (passes < 1) passes = 1;
+
+    double best = 1e30;
+    for (int sample = 0; sample < 31; sample++) {
+        start = clock::now();
+        for (long pass = 0; pass < passes; pass++)
+            loop();
+        double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count()
+                  / ((double) passes * BENCH_OPERANDS);
+        if (ns < best) best = ns;
+    }
+    return best;
+}
+
+#endif
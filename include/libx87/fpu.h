@@ -9,9 +9,15 @@ namespace libx87 {
 
 #include "libx87/softfloat/softfloat.h"
 #include "libx87/softfloat/softfloatx80.h"
+#include "libx87/host-float.h"
 
 #undef FLOATX80
 
+// log2 of the number of entries in the per-instance transcendental result cache, 0 to leave it out
+#ifndef LIBX87_TRANSCENDENTAL_CACHE_BITS
+#define LIBX87_TRANSCENDENTAL_CACHE_BITS 6
+#endif
+
     template<typename CPU_GLUE>
     class fpu {
         static const uint32_t
@@ -59,6 +65,34 @@ namespace libx87 {
 
         // These are all values used internally. They are regenerated every time fpu.control_word is modified
         float_status_t status;
+        // Arithmetic specialised for the rounding precision and mode in status, selected by set_control_word
+        const floatx80_rounding_ops *rounding_ops = floatx80_get_rounding_ops(80, float_round_nearest_even);
+        // Arithmetic on memory operands for the same rounding precision and mode
+        const floatx80_memory_ops *memory_ops = floatx80_get_memory_ops(80, float_round_nearest_even);
+        // status passed by value to the register-based arithmetic, regenerated by set_control_word
+        float_config_t config = {80, float_round_nearest_even, 0x3F, float_first_operand_nan};
+
+#if LIBX87_TRANSCENDENTAL_CACHE_BITS > 0
+        // Direct-mapped cache of transcendental results, keyed by operation, operand bits and the control
+        // word bits the result depends on (rounding, precision and exception masks). An entry holds the
+        // return value and every exception flag the operation raised, so a hit is bit-exact.
+        struct transcendental_cache_entry {
+            floatx80 a, b, res0, res1;
+            int flags;
+            uint16_t control;
+            uint8_t op; // FPU_TRANSCENDENTAL_*, 0 while the entry is empty
+            int8_t ret;
+        };
+        transcendental_cache_entry transcendental_cache[1 << LIBX87_TRANSCENDENTAL_CACHE_BITS] = {};
+        bool transcendental_cache_enabled = true;
+        uint64_t transcendental_cache_hits = 0, transcendental_cache_misses = 0;
+#endif
+
+        // Divisor of the last FPREM/FPREM1 that left its reduction incomplete. The partial steps after the
+        // first one divide by the same ST1 again and go straight to the division with its reciprocal.
+        floatx80 remainder_operand = {};
+        floatx80_remainder_divisor remainder_divisor = {};
+        bool remainder_divisor_valid = false;
 
         inline CPU_GLUE* cglue() {
             return static_cast<CPU_GLUE*>(this);
@@ -158,6 +192,8 @@ namespace libx87 {
         int read_f80(uint32_t linaddr, floatx80 *data);
         int fcom(floatx80 op1, floatx80 op2, int unordered);
         int fcomi(floatx80 op1, floatx80 op2, int unordered);
+        int transcendental(int op, floatx80 a, floatx80 b, floatx80 *res0, floatx80 *res1);
+        int remainder(floatx80 a, floatx80 b, floatx80 *r, uint64_t *q, int ieee754);
         void watchpoint();
         void watchpoint2();
 
@@ -165,6 +201,12 @@ namespace libx87 {
         int fldenv(uint32_t linaddr, int code16);
 
 
+        // Accumulates the exception flags of a register-based arithmetic result into status
+        inline floatx80 arith(floatx80_result r) {
+            status.float_exception_flags |= r.flags;
+            return floatx80_result_value(r);
+        }
+
         inline void set_c0(bool n) {
             status_word = (status_word & ~(1 << 8)) | (n) << 8;
         }
@@ -186,6 +228,11 @@ namespace libx87 {
         int reg_op(uint32_t opcode);
         int mem_op(uint32_t opcode, uint32_t linaddr, uint32_t virtaddr, uint32_t seg);
         int fwait(void);
+
+        // Enables or disables the transcendental result cache; either way it starts out empty
+        void set_transcendental_cache(bool enabled);
+        uint64_t get_transcendental_cache_hits() const;
+        uint64_t get_transcendental_cache_misses() const;
     };
 
 };
@@ -250,18 +297,30 @@ namespace libx87 {
         FPU_PRECISION_64 = 3 // 80-bit st80
     };
 
+    // Operations handled by fpu<C>::transcendental
+    enum {
+        FPU_TRANSCENDENTAL_F2XM1 = 1,
+        FPU_TRANSCENDENTAL_FYL2X,
+        FPU_TRANSCENDENTAL_FYL2XP1,
+        FPU_TRANSCENDENTAL_FPATAN,
+        FPU_TRANSCENDENTAL_FPTAN,
+        FPU_TRANSCENDENTAL_FSIN,
+        FPU_TRANSCENDENTAL_FCOS,
+        FPU_TRANSCENDENTAL_FSINCOS
+    };
+
 // Status word
 
-    static const floatx80 Zero = BUILD_FLOAT_X80(0, 0);
-    static const floatx80 IndefiniteNaN = BUILD_FLOAT_X80(0xFFFF, 0xC000000000000000);
+    static constexpr floatx80 Zero = BUILD_FLOAT_X80(0, 0);
+    static constexpr floatx80 IndefiniteNaN = BUILD_FLOAT_X80(0xFFFF, 0xC000000000000000);
 //static const floatx80 PositiveInfinity = BUILD_FLOAT(0x7FFF, 0x8000000000000000);
 //static const extFloat80_t NegativeInfinity = BUILD_FLOAT(0xFFFF, 0x8000000000000000);
-    static const floatx80 Constant_1 = BUILD_FLOAT_X80(0x3fff, 0x8000000000000000);
-    static const floatx80 Constant_L2T = BUILD_FLOAT_X80(0x4000, 0xd49a784bcd1b8afe);
-    static const floatx80 Constant_L2E = BUILD_FLOAT_X80(0x3fff, 0xb8aa3b295c17f0bc);
-    static const floatx80 Constant_PI = BUILD_FLOAT_X80(0x4000, 0xc90fdaa22168c235);
-    static const floatx80 Constant_LG2 = BUILD_FLOAT_X80(0x3ffd, 0x9a209a84fbcff799);
-    static const floatx80 Constant_LN2 = BUILD_FLOAT_X80(0x3ffe, 0xb17217f7d1cf79ac);
+    static constexpr floatx80 Constant_1 = BUILD_FLOAT_X80(0x3fff, 0x8000000000000000);
+    static constexpr floatx80 Constant_L2T = BUILD_FLOAT_X80(0x4000, 0xd49a784bcd1b8afe);
+    static constexpr floatx80 Constant_L2E = BUILD_FLOAT_X80(0x3fff, 0xb8aa3b295c17f0bc);
+    static constexpr floatx80 Constant_PI = BUILD_FLOAT_X80(0x4000, 0xc90fdaa22168c235);
+    static constexpr floatx80 Constant_LG2 = BUILD_FLOAT_X80(0x3ffd, 0x9a209a84fbcff799);
+    static constexpr floatx80 Constant_LN2 = BUILD_FLOAT_X80(0x3ffe, 0xb17217f7d1cf79ac);
 
     static const floatx80 *Constants[8] = {
             // Technically, there are only 7 constants according to the x87 spec, but to make this array nice and round, I'm going to assume that were there to be an eighth value, it would be an indefinite NaN.
@@ -311,6 +370,19 @@ namespace libx87 {
         this->status.float_suppress_exception = 0;
         this->status.float_exception_masks = control_word & 0x3F;
         this->status.denormals_are_zeros = 0;
+
+        this->config = float_config_from_status(&this->status);
+#if defined(LIBX87_HOST_FLOAT)
+        this->rounding_ops = floatx80_get_host_float_rounding_ops(this->status.float_rounding_precision,
+                                                                  this->status.float_rounding_mode);
+        this->memory_ops = floatx80_get_host_float_memory_ops(this->status.float_rounding_precision,
+                                                              this->status.float_rounding_mode);
+#else
+        this->rounding_ops = floatx80_get_rounding_ops(this->status.float_rounding_precision,
+                                                       this->status.float_rounding_mode);
+        this->memory_ops = floatx80_get_memory_ops(this->status.float_rounding_precision,
+                                                   this->status.float_rounding_mode);
+#endif
     }
 
     template<typename C>
@@ -323,10 +395,6 @@ namespace libx87 {
         return !(exponent & 0x7FFF) && mantissa;
     }
 
-    static int is_pseudo_denormal(uint16_t exponent, uint64_t mantissa) {
-        return is_denormal(exponent, mantissa) && !(mantissa & 0x8000000000000000ULL);
-    }
-
     static int is_zero(uint16_t exponent, uint64_t mantissa) {
         return ((exponent & 0x7FFF) | mantissa) == 0;
     }
@@ -374,23 +442,44 @@ namespace libx87 {
         return 0;
     }
 
-    static int fpu_get_tag_from_value(floatx80 *f) {
-        uint16_t exponent;
-        uint64_t mantissa;
-        floatx80_unpack(f, exponent, mantissa);
-        if ((exponent | mantissa) == 0) // Both exponent and mantissa are zero
-            return FPU_TAG_ZERO;
-
-        int x = 0;
-        x |= is_infinity(exponent, mantissa);
-        x |= is_denormal(exponent, mantissa);
-        x |= is_pseudo_denormal(exponent, mantissa);
-        x |= is_invalid(exponent, mantissa);
-        x |= is_nan(exponent, mantissa);
-
-        if (x)
-            return FPU_TAG_SPECIAL;
-        return FPU_TAG_VALID;
+// Tags indexed by sign << 4 | exponent class << 2 | integer bit << 1 | (mantissa != 0),
+// two bits per entry. Exponent class is 0 for 0x0001..0x7FFE, 1 for zero and 2 for 0x7FFF
+// (0xAAAA fills classes 2 and 3 with FPU_TAG_SPECIAL).
+// Only +0 is tagged as zero; every denormal, unnormal, infinity and NaN is special.
+#define FPU_TAG_CLASS_TABLE(s) \
+        ((uint32_t) FPU_TAG_SPECIAL << 0 | (uint32_t) FPU_TAG_SPECIAL << 2 | \
+         (uint32_t) FPU_TAG_VALID << 4 | (uint32_t) FPU_TAG_VALID << 6 | \
+         (uint32_t) ((s) ? FPU_TAG_VALID : FPU_TAG_ZERO) << 8 | (uint32_t) FPU_TAG_SPECIAL << 10 | \
+         (uint32_t) FPU_TAG_SPECIAL << 12 | (uint32_t) FPU_TAG_SPECIAL << 14 | \
+         (uint32_t) 0xAAAA << 16)
+
+    static const uint64_t fpu_tag_class_table = (uint64_t) FPU_TAG_CLASS_TABLE(1) << 32 | FPU_TAG_CLASS_TABLE(0);
+
+#undef FPU_TAG_CLASS_TABLE
+
+    static inline int fpu_get_tag_from_bits(uint16_t exponent, uint64_t mantissa) {
+        uint32_t biased = exponent & 0x7FFF;
+        // (biased - 1) >> 31 is set only for a zero exponent, (biased + 1) >> 15 only for 0x7FFF
+        uint32_t index = (uint32_t) (exponent >> 15) << 4
+                         | ((biased - 1) >> 31) << 2
+                         | ((biased + 1) >> 15) << 3
+                         | (uint32_t) (mantissa >> 63) << 1
+                         | (uint32_t) (mantissa != 0);
+        return (int) (fpu_tag_class_table >> (index << 1)) & 3;
+    }
+
+    static inline int fpu_get_tag_from_value(floatx80 *f) {
+        return fpu_get_tag_from_bits(f->exp, f->fraction);
+    }
+
+// Recompute the tags of all eight physical registers, keeping the ones marked empty.
+    static inline uint16_t fpu_get_tag_word_from_values(const floatx80 *regs, uint16_t tag_word) {
+        uint32_t tags = 0;
+        for (int i = 0; i < 8; i++)
+            tags |= (uint32_t) fpu_get_tag_from_bits(regs[i].exp, regs[i].fraction) << (i << 1);
+        uint32_t empty = tag_word & (tag_word >> 1) & 0x5555;
+        empty |= empty << 1;
+        return (uint16_t) ((tags & ~empty) | (tag_word & empty));
     }
 
     template<typename C>
@@ -506,7 +595,9 @@ namespace libx87 {
 
     template<typename C>
     void fpu<C>::set_st(int st_param, floatx80 data) {
-        set_tag(st_param, fpu_get_tag_from_value(&data));
+        // Only emptiness is consulted between instructions; the zero/special tags are
+        // derived from the register contents when the tag word is stored (fstenv).
+        set_tag(st_param, FPU_TAG_VALID);
         st[(ftop + st_param) & 7] = data;
     }
 
@@ -671,10 +762,7 @@ namespace libx87 {
     int fpu<C>::fstenv(uint32_t linaddr, int code16)
     {
         //fpu_debug();
-        for (int i = 0; i < 8; i++) {
-            if (get_tag(i) != FPU_TAG_EMPTY)
-                set_tag(i, fpu_get_tag_from_value(&st[(ftop + i) & 7]));
-        }
+        tag_word = fpu_get_tag_word_from_values(st, tag_word);
         // https://www.intel.com/content/dam/www/public/us/en/documents/manuals/64-ia-32-architectures-software-developer-vol-1-manual.pdf
         // page 203
         //fpu_debug();
@@ -809,6 +897,129 @@ namespace libx87 {
         //if(fpu.fpu_opcode == 0x77F8) __asm__("int3");
     }
 
+// Runs a transcendental operation through the result cache. One-operand operations take Zero as b;
+// FSIN, FCOS and FPTAN leave their result in res0 and only FSINCOS writes res1.
+    template<typename C>
+    int fpu<C>::transcendental(int op, floatx80 a, floatx80 b, floatx80 *res0, floatx80 *res1) {
+#if LIBX87_TRANSCENDENTAL_CACHE_BITS > 0
+        uint16_t control = control_word & 0x0F3F;
+        transcendental_cache_entry *entry = nullptr;
+        if (transcendental_cache_enabled) {
+            uint64_t hash = a.fraction ^ (uint64_t) a.exp << 48 ^ (uint64_t) control << 32 ^ (uint64_t) op << 28 ^ b.exp;
+            hash = (hash ^ b.fraction * 0x9E3779B97F4A7C15ULL) * 0x9E3779B97F4A7C15ULL;
+            entry = &transcendental_cache[hash >> (64 - LIBX87_TRANSCENDENTAL_CACHE_BITS)];
+            if (entry->op == op && entry->control == control &&
+                entry->a.fraction == a.fraction && entry->a.exp == a.exp &&
+                entry->b.fraction == b.fraction && entry->b.exp == b.exp) {
+                transcendental_cache_hits++;
+                status.float_exception_flags |= entry->flags;
+                *res0 = entry->res0;
+                if (res1)
+                    *res1 = entry->res1;
+                return entry->ret;
+            }
+            transcendental_cache_misses++;
+        }
+        // Collect only the flags raised by this operation so they can be replayed on a hit
+        int saved_flags = status.float_exception_flags;
+        status.float_exception_flags = 0;
+#endif
+        int ret = 0;
+        floatx80 res = Zero;
+        switch (op) {
+            case FPU_TRANSCENDENTAL_F2XM1:
+                *res0 = f2xm1(a, &status);
+                break;
+            case FPU_TRANSCENDENTAL_FYL2X:
+                *res0 = fyl2x(a, b, &status);
+                break;
+            case FPU_TRANSCENDENTAL_FYL2XP1:
+                *res0 = fyl2xp1(a, b, &status);
+                break;
+            case FPU_TRANSCENDENTAL_FPATAN:
+                *res0 = fpatan(a, b, &status);
+                break;
+            case FPU_TRANSCENDENTAL_FPTAN:
+                *res0 = a;
+                ret = ftan(res0, &status);
+                break;
+            case FPU_TRANSCENDENTAL_FSIN:
+                *res0 = a;
+                ret = fsin(res0, &status);
+                break;
+            case FPU_TRANSCENDENTAL_FCOS:
+                *res0 = a;
+                ret = fcos(res0, &status);
+                break;
+            case FPU_TRANSCENDENTAL_FSINCOS:
+                ret = fsincos(a, res0, &res, &status);
+                *res1 = res;
+                break;
+        }
+#if LIBX87_TRANSCENDENTAL_CACHE_BITS > 0
+        if (entry) {
+            entry->a = a;
+            entry->b = b;
+            entry->res0 = *res0;
+            entry->res1 = res;
+            entry->flags = status.float_exception_flags;
+            entry->control = control;
+            entry->op = op;
+            entry->ret = ret;
+        }
+        status.float_exception_flags |= saved_flags;
+#endif
+        return ret;
+    }
+
+// Runs FPREM, or FPREM1 if ieee754 is set. While the exponents are 64 or more apart both take the same exact
+// partial step, which raises no flags, so a step by the cached divisor matches the full operation bit for bit.
+    template<typename C>
+    int fpu<C>::remainder(floatx80 a, floatx80 b, floatx80 *r, uint64_t *q, int ieee754) {
+        bool same_divisor = remainder_divisor_valid &&
+                            b.fraction == remainder_operand.fraction && b.exp == remainder_operand.exp;
+        if (same_divisor && floatx80_remainder_partial(a, &remainder_divisor, r)) {
+            *q = 0;
+            return 1;
+        }
+        int ret = ieee754 ? floatx80_ieee754_remainder(a, b, r, q, &status)
+                          : floatx80_remainder(a, b, r, q, &status);
+        if (ret > 0 && !same_divisor) {
+            remainder_operand = b;
+            remainder_divisor_valid = floatx80_remainder_divisor_init(b, &remainder_divisor);
+        }
+        return ret;
+    }
+
+    template<typename C>
+    void fpu<C>::set_transcendental_cache(bool enabled) {
+#if LIBX87_TRANSCENDENTAL_CACHE_BITS > 0
+        transcendental_cache_enabled = enabled;
+        for (auto &entry : transcendental_cache)
+            entry.op = 0;
+#else
+        (void) enabled;
+#endif
+    }
+
+    template<typename C>
+    uint64_t fpu<C>::get_transcendental_cache_hits() const {
+#if LIBX87_TRANSCENDENTAL_CACHE_BITS > 0
+        return transcendental_cache_hits;
+#else
+        return 0;
+#endif
+    }
+
+    template<typename C>
+    uint64_t fpu<C>::get_transcendental_cache_misses() const {
+#if LIBX87_TRANSCENDENTAL_CACHE_BITS > 0
+        return transcendental_cache_misses;
+#else
+        return 0;
+#endif
+    }
+
 #define FPU_EXCEP() return 1
 #define FPU_ABORT()        \
     do {                   \
@@ -858,22 +1069,22 @@ namespace libx87 {
 
                 switch (smaller_opcode & 7) {
                     case 0: // FADD - Floating point add
-                        dst = floatx80_add(get_st(0), get_st(st_index), &status);
+                        dst = arith(rounding_ops->add_r(get_st(0), get_st(st_index), config));
                         break;
                     case 1: // FMUL - Floating point multiply
-                        dst = floatx80_mul(get_st(0), get_st(st_index), &status);
+                        dst = arith(rounding_ops->mul_r(get_st(0), get_st(st_index), config));
                         break;
                     case 4: // FSUB - Floating point subtract
-                        dst = floatx80_sub(get_st(0), get_st(st_index), &status);
+                        dst = arith(rounding_ops->sub_r(get_st(0), get_st(st_index), config));
                         break;
                     case 5: // FSUBR - Floating point subtract reverse
-                        dst = floatx80_sub(get_st(st_index), get_st(0), &status);
+                        dst = arith(rounding_ops->sub_r(get_st(st_index), get_st(0), config));
                         break;
                     case 6: // FDIV - Floating point divide
-                        dst = floatx80_div(get_st(0), get_st(st_index), &status);
+                        dst = arith(rounding_ops->div_r(get_st(0), get_st(st_index), config));
                         break;
                     case 7: // FDIVR - Floating point divide reverse
-                        dst = floatx80_div(get_st(st_index), get_st(0), &status);
+                        dst = arith(rounding_ops->div_r(get_st(st_index), get_st(0), config));
                         break;
                 }
                 if (!check_exceptions()) {
@@ -999,7 +1210,7 @@ namespace libx87 {
                     case 0: // D9 F0: F2XM1 - Compute 2^ST(0) - 1
                         if (check_stack_underflow(0, 1))
                             FPU_ABORT();
-                        res = f2xm1(get_st(0), &status);
+                        transcendental(FPU_TRANSCENDENTAL_F2XM1, get_st(0), Zero, &res, nullptr);
                         if (!check_exceptions())
                             set_st(0, res);
                         break;
@@ -1009,7 +1220,7 @@ namespace libx87 {
 
                         old_rounding = status.float_rounding_precision;
                         status.float_rounding_precision = 80;
-                        res = fyl2x(get_st(0), get_st(1), &status);
+                        transcendental(FPU_TRANSCENDENTAL_FYL2X, get_st(0), get_st(1), &res, nullptr);
                         status.float_rounding_precision = old_rounding;
 
                         if (!check_exceptions()) {
@@ -1020,14 +1231,13 @@ namespace libx87 {
                     case 2: // D9 F2: FPTAN - Compute tan(ST(0)) partially
                         if (check_stack_underflow(0, 1))
                             FPU_ABORT();
-                        res = get_st(0);
-                        if (!ftan(&res, &status))
+                        if (!transcendental(FPU_TRANSCENDENTAL_FPTAN, get_st(0), Zero, &res, nullptr))
                             set_st(0, res);
                         break;
                     case 3: // D9 F3: FPATAN - Compute tan-1(ST(0)) partially
                         if (check_stack_underflow(0, 1) || check_stack_underflow(1, 1))
                             FPU_ABORT();
-                        res = fpatan(get_st(0), get_st(1), &status);
+                        transcendental(FPU_TRANSCENDENTAL_FPATAN, get_st(0), get_st(1), &res, nullptr);
                         if (!check_exceptions()) {
                             pop();
                             set_st(0, res);
@@ -1048,7 +1258,7 @@ namespace libx87 {
                     case 5: { // D9 F5: FPREM1 - Partial floating point remainder
                         floatx80 st0 = get_st(0), st1 = get_st(1);
                         uint64_t quo;
-                        temp2 = floatx80_ieee754_remainder(st0, st1, &temp, &quo, &status);
+                        temp2 = remainder(st0, st1, &temp, &quo, 1);
                         if (!check_exceptions()) {
                             if (!(temp2 < 0)) {
                                 set_c0(0);
@@ -1098,7 +1308,7 @@ namespace libx87 {
                     case 0: // FPREM - Floating point partial remainder (8087/80287 compatible)
                         if (check_stack_underflow(1, 1))
                             FPU_ABORT();
-                        flags = floatx80_remainder(get_st(0), get_st(1), &dest, &quotient, &status);
+                        flags = remainder(get_st(0), get_st(1), &dest, &quotient, 0);
                         if (!check_exceptions()) {
                             if (flags < 0) {
                                 set_c0(0);
@@ -1124,21 +1334,21 @@ namespace libx87 {
                     case 1: // FYL2XP1 - Compute ST1 * log2(ST0 + 1) and pop
                         if (check_stack_underflow(1, 1))
                             FPU_ABORT();
-                        dest = fyl2xp1(get_st(0), get_st(1), &status);
+                        transcendental(FPU_TRANSCENDENTAL_FYL2XP1, get_st(0), get_st(1), &dest, nullptr);
                         if (!check_exceptions()) {
                             pop();
                             set_st(0, dest);
                         }
                         return 0;
                     case 2: // FSQRT - Compute sqrt(ST0)
-                        dest = floatx80_sqrt(get_st(0), &status);
+                        dest = arith(rounding_ops->sqrt_r(get_st(0), config));
                         break;
                     case 3: { // FSINCOS - Compute sin(ST0) and sin(ST1)
                         // TODO: What if exceptions are masked?
                         if (check_stack_overflow(-1))
                             FPU_ABORT();
                         floatx80 sinres, cosres;
-                        if (fsincos(get_st(0), &sinres, &cosres, &status) == -1) {
+                        if (transcendental(FPU_TRANSCENDENTAL_FSINCOS, get_st(0), Zero, &sinres, &cosres) == -1) {
                             set_c2(1);
                         } else if (!check_exceptions()) {
                             set_st(0, sinres);
@@ -1155,15 +1365,13 @@ namespace libx87 {
                         dest = floatx80_scale(get_st(0), get_st(1), &status);
                         break;
                     case 6: // FSIN - Find sine of ST0
-                        dest = get_st(0);
-                        if (fsin(&dest, &status) == -1) {
+                        if (transcendental(FPU_TRANSCENDENTAL_FSIN, get_st(0), Zero, &dest, nullptr) == -1) {
                             set_c2(1);
                             FPU_ABORT();
                         }
                         break;
                     case 7: // FCOS - Find cosine of ST0
-                        dest = get_st(0);
-                        if (fcos(&dest, &status) == -1) {
+                        if (transcendental(FPU_TRANSCENDENTAL_FCOS, get_st(0), Zero, &dest, nullptr) == -1) {
                             set_c2(1);
                             FPU_ABORT();
                         }
@@ -1439,27 +1647,23 @@ namespace libx87 {
                 //if(halfix.phys_eip == 0x0018b3f0) __asm__("int3");
                 if (fwait())
                     return 1;
-                switch (opcode >> 9 & 3) {
+                // The arithmetic consumes the operand in its memory format, only FCOM and FLD convert it
+                int format = opcode >> 9 & 3;
+                switch (format) {
                     case 0:
-                        cpu_read32(linaddr, temp32);
-                        temp80 = float32_to_floatx80(temp32, &status);
-                        break;
                     case 1:
                         cpu_read32(linaddr, temp32);
-                        temp80 = int32_to_floatx80(temp32);
                         break;
                     case 2: {
                         uint32_t low, hi;
-                        uint64_t res;
                         cpu_read32(linaddr, low);
                         cpu_read32(linaddr + 4, hi);
-                        res = (uint64_t)low | (uint64_t)hi << 32;
-                        temp80 = float64_to_floatx80(res, &status);
+                        temp64 = (uint64_t)low | (uint64_t)hi << 32;
                         break;
                     }
                     case 3: {
                         cpu_read16(linaddr, temp16);
-                        temp80 = int32_to_floatx80((int16_t)temp16);
+                        temp32 = (int16_t)temp16;
                         break;
                     }
                 }
@@ -1482,13 +1686,25 @@ namespace libx87 {
                         FPU_ABORT();
                 }
                 floatx80 st0 = get_st(0);
+                if ((op & 8) == 0 && (op & 6) != 2) {
+                    // FADD, FMUL, FSUB, FSUBR, FDIV, FDIVR
+                    if (format == 0)
+                        st0 = arith(memory_ops->float32_op[op](st0, temp32, config));
+                    else if (format == 2)
+                        st0 = arith(memory_ops->float64_op[op](st0, temp64, config));
+                    else
+                        st0 = arith(memory_ops->int32_op[op](st0, (int32_t)temp32, config));
+                    if (!check_exceptions())
+                        set_st(0, st0);
+                    break;
+                }
+                if (format == 0)
+                    temp80 = float32_to_floatx80(temp32, &status);
+                else if (format == 2)
+                    temp80 = float64_to_floatx80(temp64, &status);
+                else
+                    temp80 = int32_to_floatx80((int32_t)temp32);
                 switch (op) {
-                    case 0: // FADD - Floating point add
-                        st0 = floatx80_add(st0, temp80, &status);
-                        break;
-                    case 1: // FMUL - Floating point multiply
-                        st0 = floatx80_mul(st0, temp80, &status);
-                        break;
                     case 2: // FCOM - Floating point compare
                     case 3: // FCOMP - Floating point compare and pop
                         if (!fcom(st0, temp80, 0)) {
@@ -1496,26 +1712,11 @@ namespace libx87 {
                                 pop();
                         }
                         return 0;
-                    case 4: // FSUB - Floating point subtract
-                        st0 = floatx80_sub(st0, temp80, &status);
-                        break;
-                    case 5: // FSUBR - Floating point subtract with reversed operands
-                        st0 = floatx80_sub(temp80, st0, &status);
-                        break;
-                    case 6: // FDIV - Floating point divide
-                        st0 = floatx80_div(st0, temp80, &status);
-                        break;
-                    case 7: // FDIVR - Floating point divide with reversed operands
-                        st0 = floatx80_div(temp80, st0, &status);
-                        break;
                     default: // FLD
                         if (!check_exceptions())
                             push(temp80);
                         return 0;
                 }
-                if (!check_exceptions())
-                    set_st(0, st0);
-                break;
             }
 
             case OP(0xD9, 2): // FST - Store floating point register
@@ -1846,7 +2047,7 @@ namespace libx87 {
             floatx80_unpack(&val, exponent, fraction);
 
             uint32_t high = fraction >> 32;
-            std::fprintf(stderr, "ST%d(%c) [FP%d]: %04x %08x%08x (%.10f)\n", i, "v0se"[get_tag(i)], real_index, exponent,
+            std::fprintf(stderr, "ST%d(%c) [FP%d]: %04x %08x%08x (%.10f)\n", i, "v0se"[get_tag(i) == FPU_TAG_EMPTY ? FPU_TAG_EMPTY : fpu_get_tag_from_value(&val)], real_index, exponent,
                          high, (uint32_t) fraction, f);
         }
     }
@@ -0,0 +1,47 @@
+#ifndef LIBX87_HOST_FLOAT_H
+#define LIBX87_HOST_FLOAT_H
+
+// Host float/double execution backend.
+//
+// With the precision control set to 24 or 53 bits, FADD/FSUB/FMUL/FDIV/FSQRT
+// round their results like IEEE single and double precision arithmetic, and
+// differ from it only in the exponent range. When the operands are exactly
+// representable in the host type and the result lies well inside its normal
+// range, these operations are computed in host float/double arithmetic, so
+// no exception but precision can occur. The inexact flag, C1 and the three
+// directed rounding modes are derived from the sign of the rounding error,
+// which error-free transformations give exactly; the host must round to
+// nearest, as it does by default. Everything else (64-bit precision, wider
+// operands, NaNs, infinities, zeros, denormals, results near the edges of
+// the host range, unmasked exception biasing) is left to softfloat.
+//
+// Like the softfloat headers, this header is included from inside
+// namespace libx87, after softfloat.h.
+
+/*----------------------------------------------------------------------------
+| Returns the extended double-precision arithmetic for rounding to
+| `roundingPrecision' bits in rounding mode `roundingMode', executed in host
+| float/double arithmetic where possible (see `floatx80_get_rounding_ops'
+| and `floatx80_get_memory_ops').  For the full 80-bit precision, or on
+| hosts that do not evaluate float and double expressions in their own
+| type, the softfloat arithmetic is returned.
+*----------------------------------------------------------------------------*/
+
+const floatx80_rounding_ops *floatx80_get_host_float_rounding_ops(int roundingPrecision, int roundingMode);
+const floatx80_memory_ops *floatx80_get_host_float_memory_ops(int roundingPrecision, int roundingMode);
+
+/*----------------------------------------------------------------------------
+| Number of operations the host float/double arithmetic has computed itself
+| (`hits') and passed to softfloat (`misses') in the calling thread since
+| the last reset.
+*----------------------------------------------------------------------------*/
+
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+} floatx80_host_float_counters;
+
+floatx80_host_float_counters floatx80_get_host_float_counters(void);
+void floatx80_reset_host_float_counters(void);
+
+#endif
@@ -0,0 +1,1359 @@
+/*============================================================================
+This C++ header file is an extension to the SoftFloat IEC/IEEE Floating-point
+Arithmetic Package, Release 2b, written for libx87.
+
+THIS SOFTWARE IS DISTRIBUTED AS IS, FOR FREE.  Although reasonable effort has
+been made to avoid it, THIS SOFTWARE MAY CONTAIN FAULTS THAT WILL AT TIMES
+RESULT IN INCORRECT BEHAVIOR.  USE OF THIS SOFTWARE IS RESTRICTED TO PERSONS
+AND ORGANIZATIONS WHO CAN AND WILL TAKE FULL RESPONSIBILITY FOR ALL LOSSES,
+COSTS, OR OTHER PROBLEMS THEY INCUR DUE TO THE SOFTWARE, AND WHO FURTHERMORE
+EFFECTIVELY INDEMNIFY JOHN HAUSER AND THE INTERNATIONAL COMPUTER SCIENCE
+INSTITUTE (possibly via similar legal warning) AGAINST ALL LOSSES, COSTS, OR
+OTHER PROBLEMS INCURRED BY THEIR CUSTOMERS AND CLIENTS DUE TO THE SOFTWARE.
+
+Derivative works are acceptable, even for commercial purposes, so long as
+(1) the source code for the derivative work includes prominent notice that
+the work is derivative, and (2) the source code includes prominent notice with
+these four paragraphs for those parts of this code that are retained.
+=============================================================================*/
+
+#ifndef SOFTFLOAT_CONSTEXPR_H_
+#define SOFTFLOAT_CONSTEXPR_H_
+
+#include "softfloat.h"
+#include "softfloat-specialize.h"
+
+/*============================================================================
+ * Compile-time extended double-precision arithmetic.
+ *
+ * The `_constexpr' routines below can be evaluated in constant expressions
+ * (C++14 or later), so that x87 expressions over known operands can be folded
+ * when they are translated.  They take and update a `float_status_t' like
+ * the routines of the same name without the suffix and return the same
+ * values, exception flags and C1 (RAISE_SW_C1) bits.  They use the plain
+ * SoftFloat algorithms, without the fast paths and the table-seeded division
+ * and square root of the run-time routines; those all produce the correctly
+ * rounded result, so the results agree.
+ *
+ * With the register-based adapters of softfloat.h the flags come back with
+ * the value:
+ *
+ *     constexpr floatx80_result r =
+ *         floatx80_binary_result<floatx80_mul_constexpr>(a, b, config);
+ *
+ * Like the other softfloat headers, this header is included from inside
+ * namespace libx87.
+ * ==========================================================================*/
+
+#ifdef FLOATX80
+
+/*----------------------------------------------------------------------------
+| Primitive arithmetic.  These are the portable versions of the routines of
+| the same name in softfloat-macros.h.
+*----------------------------------------------------------------------------*/
+
+constexpr uint32_t shift32RightJamming_constexpr(uint32_t a, int count)
+{
+    if (count == 0) return a;
+    if (count < 32) return (a>>count) | ((a<<((-count) & 31)) != 0);
+    return (a != 0);
+}
+
+constexpr uint64_t shift64RightJamming_constexpr(uint64_t a, int count)
+{
+    if (count == 0) return a;
+    if (count < 64) return (a>>count) | ((a<<((-count) & 63)) != 0);
+    return (a != 0);
+}
+
+constexpr void shift64ExtraRightJamming_constexpr(uint64_t a0, uint64_t a1, int count, uint64_t *z0Ptr, uint64_t *z1Ptr)
+{
+    int negCount = (-count) & 63;
+
+    if (count == 0) {
+        *z1Ptr = a1;
+        *z0Ptr = a0;
+    }
+    else if (count < 64) {
+        *z1Ptr = (a0<<negCount) | (a1 != 0);
+        *z0Ptr = a0>>count;
+    }
+    else {
+        *z1Ptr = (count == 64) ? a0 | (a1 != 0) : ((a0 | a1) != 0);
+        *z0Ptr = 0;
+    }
+}
+
+constexpr void shift128Right_constexpr(uint64_t a0, uint64_t a1, int count, uint64_t *z0Ptr, uint64_t *z1Ptr)
+{
+    int negCount = (-count) & 63;
+
+    if (count == 0) {
+        *z1Ptr = a1;
+        *z0Ptr = a0;
+    }
+    else if (count < 64) {
+        *z1Ptr = (a0<<negCount) | (a1>>count);
+        *z0Ptr = a0>>count;
+    }
+    else {
+        *z1Ptr = (count < 128) ? (a0>>(count & 63)) : 0;
+        *z0Ptr = 0;
+    }
+}
+
+constexpr void shift128RightJamming_constexpr(uint64_t a0, uint64_t a1, int count, uint64_t *z0Ptr, uint64_t *z1Ptr)
+{
+    int negCount = (-count) & 63;
+
+    if (count == 0) {
+        *z1Ptr = a1;
+        *z0Ptr = a0;
+    }
+    else if (count < 64) {
+        *z1Ptr = (a0<<negCount) | (a1>>count) | ((a1<<negCount) != 0);
+        *z0Ptr = a0>>count;
+    }
+    else {
+        if (count == 64) {
+            *z1Ptr = a0 | (a1 != 0);
+        }
+        else if (count < 128) {
+            *z1Ptr = (a0>>(count & 63)) | (((a0<<negCount) | a1) != 0);
+        }
+        else {
+            *z1Ptr = ((a0 | a1) != 0);
+        }
+        *z0Ptr = 0;
+    }
+}
+
+constexpr void shortShift128Left_constexpr(uint64_t a0, uint64_t a1, int count, uint64_t *z0Ptr, uint64_t *z1Ptr)
+{
+    *z1Ptr = a1<<count;
+    *z0Ptr = (count == 0) ? a0 : (a0<<count) | (a1>>((-count) & 63));
+}
+
+constexpr void add128_constexpr(uint64_t a0, uint64_t a1, uint64_t b0, uint64_t b1, uint64_t *z0Ptr, uint64_t *z1Ptr)
+{
+    uint64_t z1 = a1 + b1;
+    *z1Ptr = z1;
+    *z0Ptr = a0 + b0 + (z1 < a1);
+}
+
+constexpr void sub128_constexpr(uint64_t a0, uint64_t a1, uint64_t b0, uint64_t b1, uint64_t *z0Ptr, uint64_t *z1Ptr)
+{
+    *z1Ptr = a1 - b1;
+    *z0Ptr = a0 - b0 - (a1 < b1);
+}
+
+constexpr void add192_constexpr(uint64_t a0, uint64_t a1, uint64_t a2, uint64_t b0, uint64_t b1, uint64_t b2,
+        uint64_t *z0Ptr, uint64_t *z1Ptr, uint64_t *z2Ptr)
+{
+    uint64_t z2 = a2 + b2;
+    unsigned carry1 = (z2 < a2);
+    uint64_t z1 = a1 + b1;
+    unsigned carry0 = (z1 < a1);
+    uint64_t z0 = a0 + b0;
+    z1 += carry1;
+    z0 += (z1 < carry1);
+    z0 += carry0;
+    *z2Ptr = z2;
+    *z1Ptr = z1;
+    *z0Ptr = z0;
+}
+
+constexpr void sub192_constexpr(uint64_t a0, uint64_t a1, uint64_t a2, uint64_t b0, uint64_t b1, uint64_t b2,
+        uint64_t *z0Ptr, uint64_t *z1Ptr, uint64_t *z2Ptr)
+{
+    uint64_t z2 = a2 - b2;
+    unsigned borrow1 = (a2 < b2);
+    uint64_t z1 = a1 - b1;
+    unsigned borrow0 = (a1 < b1);
+    uint64_t z0 = a0 - b0;
+    z0 -= (z1 < borrow1);
+    z1 -= borrow1;
+    z0 -= borrow0;
+    *z2Ptr = z2;
+    *z1Ptr = z1;
+    *z0Ptr = z0;
+}
+
+constexpr void mul64To128_constexpr(uint64_t a, uint64_t b, uint64_t *z0Ptr, uint64_t *z1Ptr)
+{
+    uint32_t aLow = (uint32_t) a;
+    uint32_t aHigh = (uint32_t)(a>>32);
+    uint32_t bLow = (uint32_t) b;
+    uint32_t bHigh = (uint32_t)(b>>32);
+    uint64_t z1 = ((uint64_t) aLow) * bLow;
+    uint64_t zMiddleA = ((uint64_t) aLow) * bHigh;
+    uint64_t zMiddleB = ((uint64_t) aHigh) * bLow;
+    uint64_t z0 = ((uint64_t) aHigh) * bHigh;
+    zMiddleA += zMiddleB;
+    z0 += (((uint64_t) (zMiddleA < zMiddleB))<<32) + (zMiddleA>>32);
+    zMiddleA <<= 32;
+    z1 += zMiddleA;
+    z0 += (z1 < zMiddleA);
+    *z1Ptr = z1;
+    *z0Ptr = z0;
+}
+
+constexpr uint64_t estimateDiv128To64_constexpr(uint64_t a0, uint64_t a1, uint64_t b)
+{
+    uint64_t rem0 = 0, rem1 = 0, term0 = 0, term1 = 0;
+
+    if (b <= a0) return U64(0xFFFFFFFFFFFFFFFF);
+    uint64_t b0 = b>>32;
+    uint64_t z = (b0<<32 <= a0) ? U64(0xFFFFFFFF00000000) : (a0 / b0)<<32;
+    mul64To128_constexpr(b, z, &term0, &term1);
+    sub128_constexpr(a0, a1, term0, term1, &rem0, &rem1);
+    while (((int64_t) rem0) < 0) {
+        z -= U64(0x100000000);
+        add128_constexpr(rem0, rem1, b0, b<<32, &rem0, &rem1);
+    }
+    rem0 = (rem0<<32) | (rem1>>32);
+    z |= (b0<<32 <= rem0) ? 0xFFFFFFFF : rem0 / b0;
+    return z;
+}
+
+static constexpr uint16_t sqrtOddAdjustments_constexpr[] = {
+    0x0004, 0x0022, 0x005D, 0x00B1, 0x011D, 0x019F, 0x0236, 0x02E0,
+    0x039C, 0x0468, 0x0545, 0x0631, 0x072B, 0x0832, 0x0946, 0x0A67
+};
+
+static constexpr uint16_t sqrtEvenAdjustments_constexpr[] = {
+    0x0A2D, 0x08AF, 0x075A, 0x0629, 0x051A, 0x0429, 0x0356, 0x029E,
+    0x0200, 0x0179, 0x0109, 0x00AF, 0x0068, 0x0034, 0x0012, 0x0002
+};
+
+constexpr uint32_t estimateSqrt32_constexpr(int16_t aExp, uint32_t a)
+{
+    uint32_t z = 0;
+
+    int index = (a>>27) & 15;
+    if (aExp & 1) {
+        z = 0x4000 + (a>>17) - sqrtOddAdjustments_constexpr[index];
+        z = ((a / z)<<14) + (z<<15);
+        a >>= 1;
+    }
+    else {
+        z = 0x8000 + (a>>17) - sqrtEvenAdjustments_constexpr[index];
+        z = a / z + z;
+        z = (0x20000 <= z) ? 0xFFFF8000 : (z<<15);
+        if (z <= a) return (uint32_t) (((int32_t) a)>>1);
+    }
+    return ((uint32_t) ((((uint64_t) a)<<31) / z)) + (z>>1);
+}
+
+constexpr int countLeadingZeros64_constexpr(uint64_t a)
+{
+    if (a == 0) return 64;
+    int shiftCount = 0;
+    if (a < U64(0x0000000100000000)) { shiftCount += 32; a <<= 32; }
+    if (a < U64(0x0001000000000000)) { shiftCount += 16; a <<= 16; }
+    if (a < U64(0x0100000000000000)) { shiftCount += 8;  a <<= 8;  }
+    if (a < U64(0x1000000000000000)) { shiftCount += 4;  a <<= 4;  }
+    if (a < U64(0x4000000000000000)) { shiftCount += 2;  a <<= 2;  }
+    if (a < U64(0x8000000000000000)) { shiftCount += 1; }
+    return shiftCount;
+}
+
+constexpr int countLeadingZeros32_constexpr(uint32_t a)
+{
+    return countLeadingZeros64_constexpr(a) - 32;
+}
+
+/*----------------------------------------------------------------------------
+| Status word access.
+*----------------------------------------------------------------------------*/
+
+constexpr void float_raise_constexpr(float_status_t *status, int flags)
+{
+    status->float_exception_flags |= flags;
+}
+
+constexpr void set_float_rounding_up_constexpr(float_status_t *status)
+{
+    status->float_exception_flags |= RAISE_SW_C1;
+}
+
+constexpr int float_exception_masked_constexpr(const float_status_t *status, int flag)
+{
+    return status->float_exception_masks & flag;
+}
+
+/*----------------------------------------------------------------------------
+| Packing, classification and NaN handling.  See softfloat-specialize.h.
+*----------------------------------------------------------------------------*/
+
+constexpr floatx80 packFloatx80_constexpr(int zSign, int32_t zExp, uint64_t zSig)
+{
+    floatx80 z = {};
+    z.fraction = zSig;
+    z.exp = (uint16_t) ((zSign << 15) + zExp);
+    return z;
+}
+
+constexpr float32 packFloat32_constexpr(int zSign, int16_t zExp, uint32_t zSig)
+{
+    return (((uint32_t) zSign)<<31) + (((uint32_t) zExp)<<23) + zSig;
+}
+
+constexpr float64 packFloat64_constexpr(int zSign, int16_t zExp, uint64_t zSig)
+{
+    return (((uint64_t) zSign)<<63) + (((uint64_t) zExp)<<52) + zSig;
+}
+
+constexpr floatx80 floatx80_default_nan_constexpr()
+{
+    return packFloatx80_constexpr(0, floatx80_default_nan_exp, floatx80_default_nan_fraction);
+}
+
+constexpr int floatx80_is_nan_constexpr(floatx80 a)
+{
+    return ((a.exp & 0x7FFF) == 0x7FFF) && (int64_t) (a.fraction<<1);
+}
+
+constexpr int floatx80_is_signaling_nan_constexpr(floatx80 a)
+{
+    uint64_t aLow = a.fraction & ~U64(0x4000000000000000);
+    return ((a.exp & 0x7FFF) == 0x7FFF) &&
+            ((uint64_t) (aLow<<1)) && (a.fraction == aLow);
+}
+
+constexpr int floatx80_is_unsupported_constexpr(floatx80 a)
+{
+    return ((a.exp & 0x7FFF) && !(a.fraction & U64(0x8000000000000000)));
+}
+
+constexpr floatx80 propagateFloatx80NaN_constexpr(floatx80 a, float_status_t *status)
+{
+    if (floatx80_is_signaling_nan_constexpr(a))
+        float_raise_constexpr(status, float_flag_invalid);
+
+    a.fraction |= U64(0xC000000000000000);
+    return a;
+}
+
+constexpr floatx80 propagateFloatx80NaN_two_args_constexpr(floatx80 a, floatx80 b, float_status_t *status)
+{
+    int aIsNaN = floatx80_is_nan_constexpr(a);
+    int aIsSignalingNaN = floatx80_is_signaling_nan_constexpr(a);
+    int bIsNaN = floatx80_is_nan_constexpr(b);
+    int bIsSignalingNaN = floatx80_is_signaling_nan_constexpr(b);
+    a.fraction |= U64(0xC000000000000000);
+    b.fraction |= U64(0xC000000000000000);
+    if (aIsSignalingNaN | bIsSignalingNaN) float_raise_constexpr(status, float_flag_invalid);
+    if (aIsSignalingNaN) {
+        if (! bIsSignalingNaN) return bIsNaN ? b : a;
+    }
+    else if (aIsNaN) {
+        if (bIsSignalingNaN | !bIsNaN) return a;
+    }
+    else {
+        return b;
+    }
+    // both operands are NaNs of the same kind: return the larger significand
+    if (a.fraction < b.fraction) return b;
+    if (b.fraction < a.fraction) return a;
+    return (a.exp < b.exp) ? a : b;
+}
+
+/*----------------------------------------------------------------------------
+| Rounding and packing.  See softfloat-round-pack.h.
+*----------------------------------------------------------------------------*/
+
+constexpr int32_t roundAndPackInt32_constexpr(int zSign, uint64_t exactAbsZ, float_status_t *status)
+{
+    int roundingMode = status->float_rounding_mode;
+    int roundNearestEven = (roundingMode == float_round_nearest_even);
+    int roundIncrement = 0x40;
+    if (!roundNearestEven) {
+        if (roundingMode == float_round_to_zero) roundIncrement = 0;
+        else {
+            roundIncrement = 0x7F;
+            if (zSign) {
+                if (roundingMode == float_round_up) roundIncrement = 0;
+            } else {
+                if (roundingMode == float_round_down) roundIncrement = 0;
+            }
+        }
+    }
+    int roundBits = (int) (exactAbsZ & 0x7F);
+    uint64_t absZ = (exactAbsZ + roundIncrement) >> 7;
+    absZ &= ~(uint64_t) (((roundBits ^ 0x40) == 0) & roundNearestEven);
+    int32_t z = (int32_t) (zSign ? 0 - (uint32_t) absZ : (uint32_t) absZ);
+    if ((absZ >> 32) || (z && ((z < 0) ^ zSign))) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return (int32_t) (int32_indefinite);
+    }
+    if (roundBits) {
+        float_raise_constexpr(status, float_flag_inexact);
+        if ((absZ << 7) > exactAbsZ)
+            set_float_rounding_up_constexpr(status);
+    }
+    return z;
+}
+
+constexpr int64_t roundAndPackInt64_constexpr(int zSign, uint64_t absZ0, uint64_t absZ1, float_status_t *status)
+{
+    int roundingMode = status->float_rounding_mode;
+    int roundNearestEven = (roundingMode == float_round_nearest_even);
+    int increment = ((int64_t) absZ1 < 0);
+    if (!roundNearestEven) {
+        if (roundingMode == float_round_to_zero) increment = 0;
+        else {
+            if (zSign) {
+                increment = (roundingMode == float_round_down) && absZ1;
+            } else {
+                increment = (roundingMode == float_round_up) && absZ1;
+            }
+        }
+    }
+    uint64_t exactAbsZ0 = absZ0;
+    if (increment) {
+        ++absZ0;
+        if (absZ0 == 0) {
+            float_raise_constexpr(status, float_flag_invalid);
+            return (int64_t) (int64_indefinite);
+        }
+        absZ0 &= ~(uint64_t) (((uint64_t) (absZ1 << 1) == 0) & roundNearestEven);
+    }
+    int64_t z = (int64_t) (zSign ? 0 - absZ0 : absZ0);
+    if (z && ((z < 0) ^ zSign)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return (int64_t) (int64_indefinite);
+    }
+    if (absZ1) {
+        float_raise_constexpr(status, float_flag_inexact);
+        if (absZ0 > exactAbsZ0)
+            set_float_rounding_up_constexpr(status);
+    }
+    return z;
+}
+
+constexpr float32 roundAndPackFloat32_constexpr(int zSign, int16_t zExp, uint32_t zSig, float_status_t *status)
+{
+    const int32_t roundMask = 0x7F;
+    int roundingMode = status->float_rounding_mode;
+    int roundNearestEven = (roundingMode == float_round_nearest_even);
+    int32_t roundIncrement = 0x40;
+    if (!roundNearestEven) {
+        if (roundingMode == float_round_to_zero) roundIncrement = 0;
+        else {
+            roundIncrement = roundMask;
+            if (zSign) {
+                if (roundingMode == float_round_up) roundIncrement = 0;
+            } else {
+                if (roundingMode == float_round_down) roundIncrement = 0;
+            }
+        }
+    }
+    int32_t roundBits = zSig & roundMask;
+    if (0xFD <= (uint16_t) zExp) {
+        if ((0xFD < zExp)
+            || ((zExp == 0xFD) && ((int32_t) (zSig + roundIncrement) < 0))) {
+            float_raise_constexpr(status, float_flag_overflow);
+            if (roundBits || float_exception_masked_constexpr(status, float_flag_overflow)) {
+                float_raise_constexpr(status, float_flag_inexact);
+                if (roundIncrement != 0) set_float_rounding_up_constexpr(status);
+            }
+            return packFloat32_constexpr(zSign, 0xFF, 0) - (roundIncrement == 0);
+        }
+        if (zExp < 0) {
+            int isTiny = (zExp < -1) || (zSig + roundIncrement < 0x80000000);
+            if (isTiny) {
+                if (!float_exception_masked_constexpr(status, float_flag_underflow)) {
+                    float_raise_constexpr(status, float_flag_underflow);
+                    zExp += 192; // bias unmasked underflow
+                }
+            }
+            if (zExp < 0) {
+                zSig = shift32RightJamming_constexpr(zSig, -zExp);
+                zExp = 0;
+                roundBits = zSig & roundMask;
+                if (isTiny) {
+                    // masked underflow
+                    if (status->flush_underflow_to_zero) {
+                        float_raise_constexpr(status, float_flag_underflow | float_flag_inexact);
+                        return packFloat32_constexpr(zSign, 0, 0);
+                    }
+                    if (roundBits) float_raise_constexpr(status, float_flag_underflow);
+                }
+            }
+        }
+    }
+    uint32_t zSigRound = ((zSig + roundIncrement) & ~roundMask) >> 7;
+    zSigRound &= ~(uint32_t) (((roundBits ^ 0x40) == 0) & roundNearestEven);
+    if (zSigRound == 0) zExp = 0;
+    if (roundBits) {
+        float_raise_constexpr(status, float_flag_inexact);
+        if ((zSigRound << 7) > zSig) set_float_rounding_up_constexpr(status);
+    }
+    return packFloat32_constexpr(zSign, zExp, zSigRound);
+}
+
+constexpr float64 roundAndPackFloat64_constexpr(int zSign, int16_t zExp, uint64_t zSig, float_status_t *status)
+{
+    const int16_t roundMask = 0x3FF;
+    int roundingMode = status->float_rounding_mode;
+    int roundNearestEven = (roundingMode == float_round_nearest_even);
+    int16_t roundIncrement = 0x200;
+    if (!roundNearestEven) {
+        if (roundingMode == float_round_to_zero) roundIncrement = 0;
+        else {
+            roundIncrement = roundMask;
+            if (zSign) {
+                if (roundingMode == float_round_up) roundIncrement = 0;
+            } else {
+                if (roundingMode == float_round_down) roundIncrement = 0;
+            }
+        }
+    }
+    int16_t roundBits = (int16_t) (zSig & roundMask);
+    if (0x7FD <= (uint16_t) zExp) {
+        if ((0x7FD < zExp)
+            || ((zExp == 0x7FD)
+                && ((int64_t) (zSig + roundIncrement) < 0))) {
+            float_raise_constexpr(status, float_flag_overflow);
+            if (roundBits || float_exception_masked_constexpr(status, float_flag_overflow)) {
+                float_raise_constexpr(status, float_flag_inexact);
+                if (roundIncrement != 0) set_float_rounding_up_constexpr(status);
+            }
+            return packFloat64_constexpr(zSign, 0x7FF, 0) - (roundIncrement == 0);
+        }
+        if (zExp < 0) {
+            int isTiny = (zExp < -1) || (zSig + roundIncrement < U64(0x8000000000000000));
+            if (isTiny) {
+                if (!float_exception_masked_constexpr(status, float_flag_underflow)) {
+                    float_raise_constexpr(status, float_flag_underflow);
+                    zExp += 1536; // bias unmasked underflow
+                }
+            }
+            if (zExp < 0) {
+                zSig = shift64RightJamming_constexpr(zSig, -zExp);
+                zExp = 0;
+                roundBits = (int16_t) (zSig & roundMask);
+                if (isTiny) {
+                    // masked underflow
+                    if (status->flush_underflow_to_zero) {
+                        float_raise_constexpr(status, float_flag_underflow | float_flag_inexact);
+                        return packFloat64_constexpr(zSign, 0, 0);
+                    }
+                    if (roundBits) float_raise_constexpr(status, float_flag_underflow);
+                }
+            }
+        }
+    }
+    uint64_t zSigRound = (zSig + roundIncrement) >> 10;
+    zSigRound &= ~(uint64_t) (((roundBits ^ 0x200) == 0) & roundNearestEven);
+    if (zSigRound == 0) zExp = 0;
+    if (roundBits) {
+        float_raise_constexpr(status, float_flag_inexact);
+        if ((zSigRound << 10) > zSig) set_float_rounding_up_constexpr(status);
+    }
+    return packFloat64_constexpr(zSign, zExp, zSigRound);
+}
+
+constexpr void normalizeFloatx80Subnormal_constexpr(uint64_t aSig, int32_t *zExpPtr, uint64_t *zSigPtr)
+{
+    int shiftCount = countLeadingZeros64_constexpr(aSig);
+    *zSigPtr = aSig << shiftCount;
+    *zExpPtr = 1 - shiftCount;
+}
+
+/*----------------------------------------------------------------------------
+| Returns the overflowed result of `roundAndPackFloatx80' for a value rounded
+| with the significand mask `roundMask': the largest finite value if the
+| rounding mode rounds the value toward zero, otherwise infinity.
+*----------------------------------------------------------------------------*/
+
+constexpr floatx80 overflowFloatx80_constexpr(int zSign, uint64_t roundMask, float_status_t *status)
+{
+    int roundingMode = status->float_rounding_mode;
+    float_raise_constexpr(status, float_flag_overflow | float_flag_inexact);
+    if ((roundingMode == float_round_to_zero)
+        || (zSign && (roundingMode == float_round_up))
+        || (!zSign && (roundingMode == float_round_down))) {
+        return packFloatx80_constexpr(zSign, 0x7FFE, ~roundMask);
+    }
+    set_float_rounding_up_constexpr(status);
+    return packFloatx80_constexpr(zSign, 0x7FFF, U64(0x8000000000000000));
+}
+
+constexpr floatx80 softRoundAndPackFloatx80_constexpr(int roundingPrecision,
+        int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1, float_status_t *status)
+{
+    int roundingMode = status->float_rounding_mode;
+    int roundNearestEven = (roundingMode == float_round_nearest_even);
+
+    if (roundingPrecision == 64 || roundingPrecision == 32) {
+        uint64_t roundIncrement = U64(0x0000000000000400);
+        uint64_t roundMask = U64(0x00000000000007FF);
+        if (roundingPrecision == 32) {
+            roundIncrement = U64(0x0000008000000000);
+            roundMask = U64(0x000000FFFFFFFFFF);
+        }
+        zSig0 |= (zSig1 != 0);
+        if (!roundNearestEven) {
+            if (roundingMode == float_round_to_zero) roundIncrement = 0;
+            else {
+                roundIncrement = roundMask;
+                if (zSign) {
+                    if (roundingMode == float_round_up) roundIncrement = 0;
+                } else {
+                    if (roundingMode == float_round_down) roundIncrement = 0;
+                }
+            }
+        }
+        uint64_t roundBits = zSig0 & roundMask;
+        if (0x7FFD <= (uint32_t) (zExp - 1)) {
+            if ((0x7FFE < zExp)
+                || ((zExp == 0x7FFE) && (zSig0 + roundIncrement < zSig0))) {
+                return overflowFloatx80_constexpr(zSign, roundMask, status);
+            }
+            if (zExp <= 0) {
+                int isTiny = (zExp < 0) || (zSig0 <= zSig0 + roundIncrement);
+                zSig0 = shift64RightJamming_constexpr(zSig0, 1 - zExp);
+                uint64_t zSigExact = zSig0;
+                zExp = 0;
+                roundBits = zSig0 & roundMask;
+                if (isTiny) {
+                    if (roundBits || (zSig0 && !float_exception_masked_constexpr(status, float_flag_underflow)))
+                        float_raise_constexpr(status, float_flag_underflow);
+                }
+                zSig0 += roundIncrement;
+                if ((int64_t) zSig0 < 0) zExp = 1;
+                roundIncrement = roundMask + 1;
+                if (roundNearestEven && (roundBits << 1 == roundIncrement))
+                    roundMask |= roundIncrement;
+                zSig0 &= ~roundMask;
+                if (roundBits) {
+                    float_raise_constexpr(status, float_flag_inexact);
+                    if (zSig0 > zSigExact) set_float_rounding_up_constexpr(status);
+                }
+                return packFloatx80_constexpr(zSign, zExp, zSig0);
+            }
+        }
+        if (roundBits) float_raise_constexpr(status, float_flag_inexact);
+        uint64_t zSigExact = zSig0;
+        zSig0 += roundIncrement;
+        if (zSig0 < roundIncrement) {
+            // Basically scale by shifting right and keep overflow
+            ++zExp;
+            zSig0 = U64(0x8000000000000000);
+            zSigExact >>= 1; // must scale also, or else later tests will fail
+        }
+        roundIncrement = roundMask + 1;
+        if (roundNearestEven && (roundBits << 1 == roundIncrement))
+            roundMask |= roundIncrement;
+        zSig0 &= ~roundMask;
+        if (zSig0 > zSigExact) set_float_rounding_up_constexpr(status);
+        if (zSig0 == 0) zExp = 0;
+        return packFloatx80_constexpr(zSign, zExp, zSig0);
+    }
+
+    int increment = ((int64_t) zSig1 < 0);
+    if (!roundNearestEven) {
+        if (roundingMode == float_round_to_zero) increment = 0;
+        else {
+            if (zSign) {
+                increment = (roundingMode == float_round_down) && zSig1;
+            } else {
+                increment = (roundingMode == float_round_up) && zSig1;
+            }
+        }
+    }
+    if (0x7FFD <= (uint32_t) (zExp - 1)) {
+        if ((0x7FFE < zExp)
+            || ((zExp == 0x7FFE)
+                && (zSig0 == U64(0xFFFFFFFFFFFFFFFF))
+                && increment)) {
+            return overflowFloatx80_constexpr(zSign, 0, status);
+        }
+        if (zExp <= 0) {
+            int isTiny = (zExp < 0) || (!increment)
+                         || (zSig0 < U64(0xFFFFFFFFFFFFFFFF));
+            shift64ExtraRightJamming_constexpr(zSig0, zSig1, 1 - zExp, &zSig0, &zSig1);
+            zExp = 0;
+            if (isTiny) {
+                if (zSig1 || (zSig0 && !float_exception_masked_constexpr(status, float_flag_underflow)))
+                    float_raise_constexpr(status, float_flag_underflow);
+            }
+            if (zSig1) float_raise_constexpr(status, float_flag_inexact);
+            if (roundNearestEven) increment = ((int64_t) zSig1 < 0);
+            else {
+                if (zSign) {
+                    increment = (roundingMode == float_round_down) && zSig1;
+                } else {
+                    increment = (roundingMode == float_round_up) && zSig1;
+                }
+            }
+            if (increment) {
+                uint64_t zSigExact = zSig0++;
+                zSig0 &= ~(uint64_t) (((uint64_t) (zSig1 << 1) == 0) & roundNearestEven);
+                if (zSig0 > zSigExact) set_float_rounding_up_constexpr(status);
+                if ((int64_t) zSig0 < 0) zExp = 1;
+            }
+            return packFloatx80_constexpr(zSign, zExp, zSig0);
+        }
+    }
+    if (zSig1) float_raise_constexpr(status, float_flag_inexact);
+    if (increment) {
+        uint64_t zSigExact = zSig0++;
+        if (zSig0 == 0) {
+            zExp++;
+            zSig0 = U64(0x8000000000000000);
+            zSigExact >>= 1;  // must scale also, or else later tests will fail
+        } else {
+            zSig0 &= ~(uint64_t) (((uint64_t) (zSig1 << 1) == 0) & roundNearestEven);
+        }
+        if (zSig0 > zSigExact) set_float_rounding_up_constexpr(status);
+    } else {
+        if (zSig0 == 0) zExp = 0;
+    }
+    return packFloatx80_constexpr(zSign, zExp, zSig0);
+}
+
+/*----------------------------------------------------------------------------
+| Constant-expression version of `roundAndPackFloatx80', including the
+| re-biasing of the exponent by 0x6000 on unmasked underflow and overflow.
+*----------------------------------------------------------------------------*/
+
+constexpr floatx80 roundAndPackFloatx80_constexpr(int roundingPrecision,
+        int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1, float_status_t *status)
+{
+    float_status_t round_status = *status;
+    floatx80 result = softRoundAndPackFloatx80_constexpr(roundingPrecision, zSign, zExp, zSig0, zSig1, status);
+
+    // bias unmasked undeflow
+    if (status->float_exception_flags & ~status->float_exception_masks & float_flag_underflow) {
+        *status = round_status;
+        float_raise_constexpr(status, float_flag_underflow);
+        return softRoundAndPackFloatx80_constexpr(roundingPrecision, zSign, zExp + 0x6000, zSig0, zSig1, status);
+    }
+
+    // bias unmasked overflow
+    if (status->float_exception_flags & ~status->float_exception_masks & float_flag_overflow) {
+        *status = round_status;
+        float_raise_constexpr(status, float_flag_overflow);
+        return softRoundAndPackFloatx80_constexpr(roundingPrecision, zSign, zExp - 0x6000, zSig0, zSig1, status);
+    }
+
+    return result;
+}
+
+/*----------------------------------------------------------------------------
+| Constant-expression version of `normalizeRoundAndPackFloatx80'.
+*----------------------------------------------------------------------------*/
+
+constexpr floatx80 normalizeRoundAndPackFloatx80_constexpr(int roundingPrecision,
+        int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1, float_status_t *status)
+{
+    if (zSig0 == 0) {
+        zSig0 = zSig1;
+        zSig1 = 0;
+        zExp -= 64;
+    }
+    int shiftCount = countLeadingZeros64_constexpr(zSig0);
+    shortShift128Left_constexpr(zSig0, zSig1, shiftCount, &zSig0, &zSig1);
+    zExp -= shiftCount;
+    return roundAndPackFloatx80_constexpr(roundingPrecision, zSign, zExp, zSig0, zSig1, status);
+}
+
+/*----------------------------------------------------------------------------
+| Conversions.  See the routines of the same name without the suffix.
+*----------------------------------------------------------------------------*/
+
+constexpr floatx80 int32_to_floatx80_constexpr(int32_t a)
+{
+    if (a == 0) return packFloatx80_constexpr(0, 0, 0);
+    int zSign = (a < 0);
+    uint64_t absA = zSign ? 0 - (uint64_t) (int64_t) a : (uint64_t) a;
+    int shiftCount = countLeadingZeros64_constexpr(absA);
+    return packFloatx80_constexpr(zSign, 0x403E - shiftCount, absA << shiftCount);
+}
+
+constexpr floatx80 int64_to_floatx80_constexpr(int64_t a)
+{
+    if (a == 0) return packFloatx80_constexpr(0, 0, 0);
+    int zSign = (a < 0);
+    uint64_t absA = zSign ? 0 - (uint64_t) a : (uint64_t) a;
+    int shiftCount = countLeadingZeros64_constexpr(absA);
+    return packFloatx80_constexpr(zSign, 0x403E - shiftCount, absA << shiftCount);
+}
+
+constexpr floatx80 float32_to_floatx80_constexpr(float32 a, float_status_t *status)
+{
+    uint32_t aSig = a & 0x007FFFFF;
+    int16_t aExp = (a>>23) & 0xFF;
+    int aSign = a>>31;
+    if (aExp == 0xFF) {
+        if (aSig) {
+            // signaling NaN: the quiet bit is clear and some other bit is set
+            if (((a>>22) & 0x1FF) == 0x1FE && (a & 0x003FFFFF))
+                float_raise_constexpr(status, float_flag_invalid);
+            return packFloatx80_constexpr(aSign, 0x7FFF, U64(0xC000000000000000) | (((uint64_t) aSig)<<40));
+        }
+        return packFloatx80_constexpr(aSign, 0x7FFF, U64(0x8000000000000000));
+    }
+    if (aExp == 0) {
+        if (aSig == 0) return packFloatx80_constexpr(aSign, 0, 0);
+        float_raise_constexpr(status, float_flag_denormal);
+        int shiftCount = countLeadingZeros32_constexpr(aSig) - 8;
+        aSig <<= shiftCount;
+        aExp = 1 - shiftCount;
+    }
+    aSig |= 0x00800000;
+    return packFloatx80_constexpr(aSign, aExp + 0x3F80, ((uint64_t) aSig) << 40);
+}
+
+constexpr floatx80 float64_to_floatx80_constexpr(float64 a, float_status_t *status)
+{
+    uint64_t aSig = a & U64(0x000FFFFFFFFFFFFF);
+    int16_t aExp = (int16_t) ((a>>52) & 0x7FF);
+    int aSign = (int) (a>>63);
+
+    if (aExp == 0x7FF) {
+        if (aSig) {
+            // signaling NaN: the quiet bit is clear and some other bit is set
+            if (((a>>51) & 0xFFF) == 0xFFE && (a & U64(0x0007FFFFFFFFFFFF)))
+                float_raise_constexpr(status, float_flag_invalid);
+            return packFloatx80_constexpr(aSign, 0x7FFF, U64(0xC000000000000000) | ((a<<12)>>1));
+        }
+        return packFloatx80_constexpr(aSign, 0x7FFF, U64(0x8000000000000000));
+    }
+    if (aExp == 0) {
+        if (aSig == 0) return packFloatx80_constexpr(aSign, 0, 0);
+        float_raise_constexpr(status, float_flag_denormal);
+        int shiftCount = countLeadingZeros64_constexpr(aSig) - 11;
+        aSig <<= shiftCount;
+        aExp = 1 - shiftCount;
+    }
+    return packFloatx80_constexpr(aSign, aExp + 0x3C00, (aSig | U64(0x0010000000000000)) << 11);
+}
+
+constexpr int32_t floatx80_to_int32_constexpr(floatx80 a, float_status_t *status)
+{
+    uint64_t aSig = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    int aSign = a.exp>>15;
+
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return int32_indefinite;
+    }
+
+    if ((aExp == 0x7FFF) && (uint64_t) (aSig << 1)) aSign = 0;
+    int shiftCount = 0x4037 - aExp;
+    if (shiftCount <= 0) shiftCount = 1;
+    aSig = shift64RightJamming_constexpr(aSig, shiftCount);
+    return roundAndPackInt32_constexpr(aSign, aSig, status);
+}
+
+constexpr int32_t floatx80_to_int32_round_to_zero_constexpr(floatx80 a, float_status_t *status)
+{
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return int32_indefinite;
+    }
+
+    uint64_t aSig = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    int aSign = a.exp>>15;
+
+    if (aExp > 0x401E) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return (int32_t) (int32_indefinite);
+    }
+    if (aExp < 0x3FFF) {
+        if (aExp || aSig) float_raise_constexpr(status, float_flag_inexact);
+        return 0;
+    }
+    int shiftCount = 0x403E - aExp;
+    uint64_t savedASig = aSig;
+    aSig >>= shiftCount;
+    int32_t z = (int32_t) (aSign ? 0 - (uint32_t) aSig : (uint32_t) aSig);
+    if ((z < 0) ^ aSign) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return (int32_t) (int32_indefinite);
+    }
+    if ((aSig << shiftCount) != savedASig) {
+        float_raise_constexpr(status, float_flag_inexact);
+    }
+    return z;
+}
+
+constexpr int64_t floatx80_to_int64_constexpr(floatx80 a, float_status_t *status)
+{
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return int64_indefinite;
+    }
+
+    uint64_t aSig = a.fraction, aSigExtra = 0;
+    int32_t aExp = a.exp & 0x7FFF;
+    int aSign = a.exp>>15;
+
+    int shiftCount = 0x403E - aExp;
+    if (shiftCount <= 0) {
+        if (shiftCount) {
+            float_raise_constexpr(status, float_flag_invalid);
+            return (int64_t) (int64_indefinite);
+        }
+    } else {
+        shift64ExtraRightJamming_constexpr(aSig, 0, shiftCount, &aSig, &aSigExtra);
+    }
+
+    return roundAndPackInt64_constexpr(aSign, aSig, aSigExtra, status);
+}
+
+constexpr int64_t floatx80_to_int64_round_to_zero_constexpr(floatx80 a, float_status_t *status)
+{
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return int64_indefinite;
+    }
+
+    uint64_t aSig = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    int aSign = a.exp>>15;
+    int shiftCount = aExp - 0x403E;
+    if (0 <= shiftCount) {
+        aSig &= U64(0x7FFFFFFFFFFFFFFF);
+        if ((a.exp != 0xC03E) || aSig) {
+            float_raise_constexpr(status, float_flag_invalid);
+        }
+        return (int64_t) (int64_indefinite);
+    }
+    else if (aExp < 0x3FFF) {
+        if (aExp | aSig) float_raise_constexpr(status, float_flag_inexact);
+        return 0;
+    }
+    int64_t z = aSig >> (-shiftCount);
+    if ((uint64_t) (aSig << (shiftCount & 63))) {
+        float_raise_constexpr(status, float_flag_inexact);
+    }
+    if (aSign) z = -z;
+    return z;
+}
+
+constexpr float32 floatx80_to_float32_constexpr(floatx80 a, float_status_t *status)
+{
+    uint64_t aSig = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    int aSign = a.exp>>15;
+
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return 0xFFC00000;  // float32_default_nan
+    }
+
+    if (aExp == 0x7FFF) {
+        if ((uint64_t) (aSig << 1)) {
+            if (floatx80_is_signaling_nan_constexpr(a)) float_raise_constexpr(status, float_flag_invalid);
+            return (((uint32_t) aSign)<<31) | 0x7FC00000 | (uint32_t) ((aSig << 1)>>41);
+        }
+        return packFloat32_constexpr(aSign, 0xFF, 0);
+    }
+    aSig = shift64RightJamming_constexpr(aSig, 33);
+    if (aExp || aSig) aExp -= 0x3F81;
+    return roundAndPackFloat32_constexpr(aSign, (int16_t) aExp, (uint32_t) aSig, status);
+}
+
+constexpr float64 floatx80_to_float64_constexpr(floatx80 a, float_status_t *status)
+{
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return U64(0xFFF8000000000000);  // float64_default_nan
+    }
+
+    uint64_t aSig = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    int aSign = a.exp>>15;
+
+    if (aExp == 0x7FFF) {
+        if ((uint64_t) (aSig << 1)) {
+            if (floatx80_is_signaling_nan_constexpr(a)) float_raise_constexpr(status, float_flag_invalid);
+            return (((uint64_t) aSign)<<63) | U64(0x7FF8000000000000) | ((aSig << 1)>>12);
+        }
+        return packFloat64_constexpr(aSign, 0x7FF, 0);
+    }
+    uint64_t zSig = shift64RightJamming_constexpr(aSig, 1);
+    if (aExp || aSig) aExp -= 0x3C01;
+    return roundAndPackFloat64_constexpr(aSign, (int16_t) aExp, zSig, status);
+}
+
+/*----------------------------------------------------------------------------
+| Arithmetic.  See the routines of the same name without the suffix.
+*----------------------------------------------------------------------------*/
+
+constexpr floatx80 addFloatx80Sigs_constexpr(floatx80 a, floatx80 b, int zSign, float_status_t *status)
+{
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a) || floatx80_is_unsupported_constexpr(b)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return floatx80_default_nan_constexpr();
+    }
+
+    uint64_t aSig = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    uint64_t bSig = b.fraction;
+    int32_t bExp = b.exp & 0x7FFF;
+
+    if (aExp == 0x7FFF) {
+        if ((uint64_t) (aSig << 1) || ((bExp == 0x7FFF) && (uint64_t) (bSig << 1)))
+            return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+        if (bSig && (bExp == 0)) float_raise_constexpr(status, float_flag_denormal);
+        return a;
+    }
+    if (bExp == 0x7FFF) {
+        if ((uint64_t) (bSig << 1)) return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+        if (aSig && (aExp == 0)) float_raise_constexpr(status, float_flag_denormal);
+        return packFloatx80_constexpr(zSign, 0x7FFF, U64(0x8000000000000000));
+    }
+    if (aExp == 0) {
+        if (aSig == 0) {
+            if ((bExp == 0) && bSig) {
+                float_raise_constexpr(status, float_flag_denormal);
+                normalizeFloatx80Subnormal_constexpr(bSig, &bExp, &bSig);
+            }
+            return roundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                                  zSign, bExp, bSig, 0, status);
+        }
+        float_raise_constexpr(status, float_flag_denormal);
+        normalizeFloatx80Subnormal_constexpr(aSig, &aExp, &aSig);
+    }
+    if (bExp == 0) {
+        if (bSig == 0)
+            return roundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                                  zSign, aExp, aSig, 0, status);
+
+        float_raise_constexpr(status, float_flag_denormal);
+        normalizeFloatx80Subnormal_constexpr(bSig, &bExp, &bSig);
+    }
+    int32_t expDiff = aExp - bExp;
+    int32_t zExp = aExp;
+    uint64_t zSig0 = 0, zSig1 = 0;
+    if (0 < expDiff) {
+        shift64ExtraRightJamming_constexpr(bSig, 0, expDiff, &bSig, &zSig1);
+    } else if (expDiff < 0) {
+        shift64ExtraRightJamming_constexpr(aSig, 0, -expDiff, &aSig, &zSig1);
+        zExp = bExp;
+    }
+    zSig0 = aSig + bSig;
+    if (expDiff == 0 || (int64_t) zSig0 >= 0) {
+        shift64ExtraRightJamming_constexpr(zSig0, zSig1, 1, &zSig0, &zSig1);
+        zSig0 |= U64(0x8000000000000000);
+        zExp++;
+    }
+    return roundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                          zSign, zExp, zSig0, zSig1, status);
+}
+
+constexpr floatx80 subFloatx80Sigs_constexpr(floatx80 a, floatx80 b, int zSign, float_status_t *status)
+{
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a) || floatx80_is_unsupported_constexpr(b)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return floatx80_default_nan_constexpr();
+    }
+
+    uint64_t aSig = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    uint64_t bSig = b.fraction;
+    int32_t bExp = b.exp & 0x7FFF;
+
+    if (aExp == 0x7FFF) {
+        if ((uint64_t) (aSig << 1)) return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+        if (bExp == 0x7FFF) {
+            if ((uint64_t) (bSig << 1)) return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+            float_raise_constexpr(status, float_flag_invalid);
+            return floatx80_default_nan_constexpr();
+        }
+        if (bSig && (bExp == 0)) float_raise_constexpr(status, float_flag_denormal);
+        return a;
+    }
+    if (bExp == 0x7FFF) {
+        if ((uint64_t) (bSig << 1)) return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+        if (aSig && (aExp == 0)) float_raise_constexpr(status, float_flag_denormal);
+        return packFloatx80_constexpr(zSign ^ 1, 0x7FFF, U64(0x8000000000000000));
+    }
+    if (aExp == 0) {
+        if (aSig == 0) {
+            if (bExp == 0) {
+                if (bSig) {
+                    float_raise_constexpr(status, float_flag_denormal);
+                    normalizeFloatx80Subnormal_constexpr(bSig, &bExp, &bSig);
+                    return roundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                                          zSign ^ 1, bExp, bSig, 0, status);
+                }
+                return packFloatx80_constexpr(status->float_rounding_mode == float_round_down, 0, 0);
+            }
+            return roundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                                  zSign ^ 1, bExp, bSig, 0, status);
+        }
+        float_raise_constexpr(status, float_flag_denormal);
+        normalizeFloatx80Subnormal_constexpr(aSig, &aExp, &aSig);
+    }
+    if (bExp == 0) {
+        if (bSig == 0)
+            return roundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                                  zSign, aExp, aSig, 0, status);
+
+        float_raise_constexpr(status, float_flag_denormal);
+        normalizeFloatx80Subnormal_constexpr(bSig, &bExp, &bSig);
+    }
+    int32_t expDiff = aExp - bExp;
+    uint64_t zSig0 = 0, zSig1 = 0;
+    if (0 < expDiff) {
+        shift128RightJamming_constexpr(bSig, 0, expDiff, &bSig, &zSig1);
+    }
+    else if (expDiff < 0) {
+        shift128RightJamming_constexpr(aSig, 0, -expDiff, &aSig, &zSig1);
+    }
+    else if (aSig == bSig) {
+        return packFloatx80_constexpr(status->float_rounding_mode == float_round_down, 0, 0);
+    }
+    int32_t zExp = aExp;
+    if (expDiff < 0 || (expDiff == 0 && aSig < bSig)) {
+        sub128_constexpr(bSig, 0, aSig, zSig1, &zSig0, &zSig1);
+        zExp = bExp;
+        zSign ^= 1;
+    }
+    else {
+        sub128_constexpr(aSig, 0, bSig, zSig1, &zSig0, &zSig1);
+    }
+    return normalizeRoundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                                   zSign, zExp, zSig0, zSig1, status);
+}
+
+constexpr floatx80 floatx80_add_constexpr(floatx80 a, floatx80 b, float_status_t *status)
+{
+    int aSign = a.exp>>15;
+    int bSign = b.exp>>15;
+
+    if (aSign == bSign)
+        return addFloatx80Sigs_constexpr(a, b, aSign, status);
+    else
+        return subFloatx80Sigs_constexpr(a, b, aSign, status);
+}
+
+constexpr floatx80 floatx80_sub_constexpr(floatx80 a, floatx80 b, float_status_t *status)
+{
+    int aSign = a.exp>>15;
+    int bSign = b.exp>>15;
+
+    if (aSign == bSign)
+        return subFloatx80Sigs_constexpr(a, b, aSign, status);
+    else
+        return addFloatx80Sigs_constexpr(a, b, aSign, status);
+}
+
+constexpr floatx80 floatx80_mul_constexpr(floatx80 a, floatx80 b, float_status_t *status)
+{
+    uint64_t aSig = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    uint64_t bSig = b.fraction;
+    int32_t bExp = b.exp & 0x7FFF;
+    int zSign = (a.exp ^ b.exp)>>15;
+
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a) || floatx80_is_unsupported_constexpr(b)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return floatx80_default_nan_constexpr();
+    }
+
+    if (aExp == 0x7FFF) {
+        if ((uint64_t) (aSig << 1) || ((bExp == 0x7FFF) && (uint64_t) (bSig << 1))) {
+            return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+        }
+        if (bExp == 0) {
+            if (bSig == 0) {
+                float_raise_constexpr(status, float_flag_invalid);
+                return floatx80_default_nan_constexpr();
+            }
+            float_raise_constexpr(status, float_flag_denormal);
+        }
+        return packFloatx80_constexpr(zSign, 0x7FFF, U64(0x8000000000000000));
+    }
+    if (bExp == 0x7FFF) {
+        if ((uint64_t) (bSig << 1)) return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+        if (aExp == 0) {
+            if (aSig == 0) {
+                float_raise_constexpr(status, float_flag_invalid);
+                return floatx80_default_nan_constexpr();
+            }
+            float_raise_constexpr(status, float_flag_denormal);
+        }
+        return packFloatx80_constexpr(zSign, 0x7FFF, U64(0x8000000000000000));
+    }
+    if (aExp == 0) {
+        if (aSig == 0) {
+            if (bSig && (bExp == 0)) float_raise_constexpr(status, float_flag_denormal);
+            return packFloatx80_constexpr(zSign, 0, 0);
+        }
+        float_raise_constexpr(status, float_flag_denormal);
+        normalizeFloatx80Subnormal_constexpr(aSig, &aExp, &aSig);
+    }
+    if (bExp == 0) {
+        if (bSig == 0) return packFloatx80_constexpr(zSign, 0, 0);
+        float_raise_constexpr(status, float_flag_denormal);
+        normalizeFloatx80Subnormal_constexpr(bSig, &bExp, &bSig);
+    }
+    int32_t zExp = aExp + bExp - 0x3FFE;
+    uint64_t zSig0 = 0, zSig1 = 0;
+    mul64To128_constexpr(aSig, bSig, &zSig0, &zSig1);
+    if (0 < (int64_t) zSig0) {
+        shortShift128Left_constexpr(zSig0, zSig1, 1, &zSig0, &zSig1);
+        --zExp;
+    }
+    return roundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                          zSign, zExp, zSig0, zSig1, status);
+}
+
+constexpr floatx80 floatx80_div_constexpr(floatx80 a, floatx80 b, float_status_t *status)
+{
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a) || floatx80_is_unsupported_constexpr(b)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return floatx80_default_nan_constexpr();
+    }
+
+    uint64_t aSig = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    uint64_t bSig = b.fraction;
+    int32_t bExp = b.exp & 0x7FFF;
+    int zSign = (a.exp ^ b.exp)>>15;
+
+    if (aExp == 0x7FFF) {
+        if ((uint64_t) (aSig << 1)) return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+        if (bExp == 0x7FFF) {
+            if ((uint64_t) (bSig << 1)) return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+            float_raise_constexpr(status, float_flag_invalid);
+            return floatx80_default_nan_constexpr();
+        }
+        if (bSig && (bExp == 0)) float_raise_constexpr(status, float_flag_denormal);
+        return packFloatx80_constexpr(zSign, 0x7FFF, U64(0x8000000000000000));
+    }
+    if (bExp == 0x7FFF) {
+        if ((uint64_t) (bSig << 1)) return propagateFloatx80NaN_two_args_constexpr(a, b, status);
+        if (aSig && (aExp == 0)) float_raise_constexpr(status, float_flag_denormal);
+        return packFloatx80_constexpr(zSign, 0, 0);
+    }
+    if (bExp == 0) {
+        if (bSig == 0) {
+            if ((aExp | aSig) == 0) {
+                float_raise_constexpr(status, float_flag_invalid);
+                return floatx80_default_nan_constexpr();
+            }
+            float_raise_constexpr(status, float_flag_divbyzero);
+            return packFloatx80_constexpr(zSign, 0x7FFF, U64(0x8000000000000000));
+        }
+        float_raise_constexpr(status, float_flag_denormal);
+        normalizeFloatx80Subnormal_constexpr(bSig, &bExp, &bSig);
+    }
+    if (aExp == 0) {
+        if (aSig == 0) return packFloatx80_constexpr(zSign, 0, 0);
+        float_raise_constexpr(status, float_flag_denormal);
+        normalizeFloatx80Subnormal_constexpr(aSig, &aExp, &aSig);
+    }
+    int32_t zExp = aExp - bExp + 0x3FFE;
+    uint64_t rem0 = 0, rem1 = 0, rem2 = 0, term0 = 0, term1 = 0, term2 = 0;
+    if (bSig <= aSig) {
+        shift128Right_constexpr(aSig, 0, 1, &aSig, &rem1);
+        ++zExp;
+    }
+    uint64_t zSig0 = estimateDiv128To64_constexpr(aSig, rem1, bSig);
+    mul64To128_constexpr(bSig, zSig0, &term0, &term1);
+    sub128_constexpr(aSig, rem1, term0, term1, &rem0, &rem1);
+    while ((int64_t) rem0 < 0) {
+        --zSig0;
+        add128_constexpr(rem0, rem1, 0, bSig, &rem0, &rem1);
+    }
+    uint64_t zSig1 = estimateDiv128To64_constexpr(rem1, 0, bSig);
+    if ((uint64_t) (zSig1 << 1) <= 8) {
+        mul64To128_constexpr(bSig, zSig1, &term1, &term2);
+        sub128_constexpr(rem1, 0, term1, term2, &rem1, &rem2);
+        while ((int64_t) rem1 < 0) {
+            --zSig1;
+            add128_constexpr(rem1, rem2, 0, bSig, &rem1, &rem2);
+        }
+        zSig1 |= ((rem1 | rem2) != 0);
+    }
+    return roundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                          zSign, zExp, zSig0, zSig1, status);
+}
+
+constexpr floatx80 floatx80_sqrt_constexpr(floatx80 a, float_status_t *status)
+{
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported_constexpr(a)) {
+        float_raise_constexpr(status, float_flag_invalid);
+        return floatx80_default_nan_constexpr();
+    }
+
+    uint64_t aSig0 = a.fraction;
+    int32_t aExp = a.exp & 0x7FFF;
+    int aSign = a.exp>>15;
+    if (aExp == 0x7FFF) {
+        if ((uint64_t) (aSig0 << 1)) return propagateFloatx80NaN_constexpr(a, status);
+        if (!aSign) return a;
+        float_raise_constexpr(status, float_flag_invalid);
+        return floatx80_default_nan_constexpr();
+    }
+    if (aSign) {
+        if ((aExp | aSig0) == 0) return a;
+        float_raise_constexpr(status, float_flag_invalid);
+        return floatx80_default_nan_constexpr();
+    }
+    if (aExp == 0) {
+        if (aSig0 == 0) return packFloatx80_constexpr(0, 0, 0);
+        float_raise_constexpr(status, float_flag_denormal);
+        normalizeFloatx80Subnormal_constexpr(aSig0, &aExp, &aSig0);
+    }
+    uint64_t aSig1 = 0, rem0 = 0, rem1 = 0, rem2 = 0, rem3 = 0;
+    uint64_t term0 = 0, term1 = 0, term2 = 0, term3 = 0;
+    int32_t zExp = ((aExp - 0x3FFF) >> 1) + 0x3FFF;
+    uint64_t zSig0 = estimateSqrt32_constexpr((int16_t) aExp, (uint32_t) (aSig0 >> 32));
+    shift128Right_constexpr(aSig0, 0, 2 + (aExp & 1), &aSig0, &aSig1);
+    zSig0 = estimateDiv128To64_constexpr(aSig0, aSig1, zSig0 << 32) + (zSig0 << 30);
+    uint64_t doubleZSig0 = zSig0 << 1;
+    mul64To128_constexpr(zSig0, zSig0, &term0, &term1);
+    sub128_constexpr(aSig0, aSig1, term0, term1, &rem0, &rem1);
+    while ((int64_t) rem0 < 0) {
+        --zSig0;
+        doubleZSig0 -= 2;
+        add128_constexpr(rem0, rem1, zSig0 >> 63, doubleZSig0 | 1, &rem0, &rem1);
+    }
+    uint64_t zSig1 = estimateDiv128To64_constexpr(rem1, 0, doubleZSig0);
+    if ((zSig1 & U64(0x3FFFFFFFFFFFFFFF)) <= 5) {
+        if (zSig1 == 0) zSig1 = 1;
+        mul64To128_constexpr(doubleZSig0, zSig1, &term1, &term2);
+        sub128_constexpr(rem1, 0, term1, term2, &rem1, &rem2);
+        mul64To128_constexpr(zSig1, zSig1, &term2, &term3);
+        sub192_constexpr(rem1, rem2, 0, 0, term2, term3, &rem1, &rem2, &rem3);
+        while ((int64_t) rem1 < 0) {
+            --zSig1;
+            shortShift128Left_constexpr(0, zSig1, 1, &term2, &term3);
+            term3 |= 1;
+            term2 |= doubleZSig0;
+            add192_constexpr(rem1, rem2, rem3, 0, term2, term3, &rem1, &rem2, &rem3);
+        }
+        zSig1 |= ((rem1 | rem2 | rem3) != 0);
+    }
+    shortShift128Left_constexpr(0, zSig1, 1, &zSig0, &zSig1);
+    zSig0 |= doubleZSig0;
+    return roundAndPackFloatx80_constexpr(status->float_rounding_precision,
+                                          0, zExp, zSig0, zSig1, status);
+}
+
+#endif /* FLOATX80 */
+
+#endif
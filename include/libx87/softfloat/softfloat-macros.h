@@ -35,6 +35,60 @@ these four paragraphs for those parts of this code that are retained.
 #ifndef SOFTFLOAT_MACROS_H_
 #define SOFTFLOAT_MACROS_H_
 
+/*----------------------------------------------------------------------------
+| Native 128-bit arithmetic.  When the compiler provides `unsigned __int128'
+| (GCC and Clang on x86-64 and other 64-bit hosts), the multi-word primitives
+| below are written on top of it, so that a 64x64->128 multiply becomes a
+| single MUL/MULX and the 128/192-bit additions become ADD/ADC chains.  The
+| portable 32-bit limb code is kept as a fallback and can be forced by
+| defining LIBX87_PORTABLE_ARITH.
+*----------------------------------------------------------------------------*/
+
+#if defined(__SIZEOF_INT128__) && !defined(LIBX87_PORTABLE_ARITH)
+#define LIBX87_NATIVE_INT128
+typedef unsigned __int128 uint128_native;
+typedef __int128 int128_native;
+
+BX_CPP_INLINE uint128_native pack128(uint64_t a0, uint64_t a1)
+{
+    return ((uint128_native) a0<<64) | a1;
+}
+#endif
+
+/*----------------------------------------------------------------------------
+| Hardware 128/64-bit division.  On x86-64 a single DIVQ produces the exact
+| 64-bit quotient and remainder of a 128-bit dividend, as long as the quotient
+| does not overflow.  Disabled together with the native 128-bit arithmetic by
+| LIBX87_PORTABLE_ARITH.
+*----------------------------------------------------------------------------*/
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(LIBX87_PORTABLE_ARITH)
+#define LIBX87_HW_DIVIDE
+#endif
+
+/*----------------------------------------------------------------------------
+| Leading-zero counting.  With GCC and Clang the countLeadingZeros* helpers
+| map to __builtin_clz/__builtin_clzll, i.e. a single BSR or LZCNT, instead of
+| the 256-entry table walk.  Disabled by LIBX87_PORTABLE_ARITH.
+*----------------------------------------------------------------------------*/
+
+#if defined(__GNUC__) && !defined(LIBX87_PORTABLE_ARITH)
+#define LIBX87_CLZ_BUILTIN
+#endif
+
+/*----------------------------------------------------------------------------
+| Reciprocal division.  When LIBX87_DIV_NEWTON is defined, floatx80_div
+| divides by multiplying with a 64-bit reciprocal of the divisor, obtained
+| from a small seed table and refined by Newton-Raphson iterations, instead
+| of dividing.  The engine needs the native 128-bit arithmetic, and is also
+| used by the partial remainder steps, which divide by the same divisor many
+| times over.
+*----------------------------------------------------------------------------*/
+
+#if defined(LIBX87_DIV_NEWTON) && !defined(LIBX87_NATIVE_INT128)
+#undef LIBX87_DIV_NEWTON
+#endif
+
 /*----------------------------------------------------------------------------
 | Shifts `a' right by the number of bits given in `count'.  If any nonzero
 | bits are shifted off, they are ``jammed'' into the least significant bit of
@@ -162,9 +216,15 @@ BX_CPP_INLINE void shift64ExtraRightJamming(uint64_t a0, uint64_t a1, int count,
 
 BX_CPP_INLINE void add128(uint64_t a0, uint64_t a1, uint64_t b0, uint64_t b1, uint64_t *z0Ptr, uint64_t *z1Ptr)
 {
+#ifdef LIBX87_NATIVE_INT128
+    uint128_native z = pack128(a0, a1) + pack128(b0, b1);
+    *z1Ptr = (uint64_t) z;
+    *z0Ptr = (uint64_t)(z>>64);
+#else
     uint64_t z1 = a1 + b1;
     *z1Ptr = z1;
     *z0Ptr = a0 + b0 + (z1 < a1);
+#endif
 }
 
 /*----------------------------------------------------------------------------
@@ -178,8 +238,14 @@ BX_CPP_INLINE void add128(uint64_t a0, uint64_t a1, uint64_t b0, uint64_t b1, ui
 BX_CPP_INLINE void
  sub128(uint64_t a0, uint64_t a1, uint64_t b0, uint64_t b1, uint64_t *z0Ptr, uint64_t *z1Ptr)
 {
+#ifdef LIBX87_NATIVE_INT128
+    uint128_native z = pack128(a0, a1) - pack128(b0, b1);
+    *z1Ptr = (uint64_t) z;
+    *z0Ptr = (uint64_t)(z>>64);
+#else
     *z1Ptr = a1 - b1;
     *z0Ptr = a0 - b0 - (a1 < b1);
+#endif
 }
 
 /*----------------------------------------------------------------------------
@@ -190,6 +256,11 @@ BX_CPP_INLINE void
 
 BX_CPP_INLINE void mul64To128(uint64_t a, uint64_t b, uint64_t *z0Ptr, uint64_t *z1Ptr)
 {
+#ifdef LIBX87_NATIVE_INT128
+    uint128_native z = (uint128_native) a * b;
+    *z1Ptr = (uint64_t) z;
+    *z0Ptr = (uint64_t)(z>>64);
+#else
     uint32_t aHigh, aLow, bHigh, bLow;
     uint64_t z0, zMiddleA, zMiddleB, z1;
 
@@ -208,8 +279,121 @@ BX_CPP_INLINE void mul64To128(uint64_t a, uint64_t b, uint64_t *z0Ptr, uint64_t
     z0 += (z1 < zMiddleA);
     *z1Ptr = z1;
     *z0Ptr = z0;
+#endif
 }
 
+#ifdef LIBX87_HW_DIVIDE
+
+/*----------------------------------------------------------------------------
+| Divides the 128-bit value formed by concatenating `a0' and `a1' by `b'.  The
+| quotient, truncated toward zero, is returned and the remainder is stored at
+| the location pointed to by `remPtr'.  `a0' must be less than `b', so that
+| the quotient fits in 64 bits.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE uint64_t div128By64To64(uint64_t a0, uint64_t a1, uint64_t b, uint64_t *remPtr)
+{
+    uint64_t q, r;
+    __asm__("divq %4" : "=a" (q), "=d" (r) : "a" (a1), "d" (a0), "rm" (b));
+    *remPtr = r;
+    return q;
+}
+
+#endif
+
+#ifdef LIBX87_NATIVE_INT128
+
+/*----------------------------------------------------------------------------
+| 11-bit reciprocal seeds floor((2^19 - 3*2^8) / d) for the 256 values of the
+| nine leading bits d of a normalized divisor.
+*----------------------------------------------------------------------------*/
+
+static const uint16_t reciprocal64_seed[256] = {
+    0x7FD, 0x7F5, 0x7ED, 0x7E5, 0x7DD, 0x7D5, 0x7CE, 0x7C6,
+    0x7BF, 0x7B7, 0x7B0, 0x7A8, 0x7A1, 0x79A, 0x792, 0x78B,
+    0x784, 0x77D, 0x776, 0x76F, 0x768, 0x761, 0x75B, 0x754,
+    0x74D, 0x747, 0x740, 0x739, 0x733, 0x72C, 0x726, 0x720,
+    0x719, 0x713, 0x70D, 0x707, 0x700, 0x6FA, 0x6F4, 0x6EE,
+    0x6E8, 0x6E2, 0x6DC, 0x6D6, 0x6D1, 0x6CB, 0x6C5, 0x6BF,
+    0x6BA, 0x6B4, 0x6AE, 0x6A9, 0x6A3, 0x69E, 0x698, 0x693,
+    0x68D, 0x688, 0x683, 0x67D, 0x678, 0x673, 0x66E, 0x669,
+    0x664, 0x65E, 0x659, 0x654, 0x64F, 0x64A, 0x645, 0x640,
+    0x63C, 0x637, 0x632, 0x62D, 0x628, 0x624, 0x61F, 0x61A,
+    0x616, 0x611, 0x60C, 0x608, 0x603, 0x5FF, 0x5FA, 0x5F6,
+    0x5F1, 0x5ED, 0x5E9, 0x5E4, 0x5E0, 0x5DC, 0x5D7, 0x5D3,
+    0x5CF, 0x5CB, 0x5C6, 0x5C2, 0x5BE, 0x5BA, 0x5B6, 0x5B2,
+    0x5AE, 0x5AA, 0x5A6, 0x5A2, 0x59E, 0x59A, 0x596, 0x592,
+    0x58E, 0x58A, 0x586, 0x583, 0x57F, 0x57B, 0x577, 0x574,
+    0x570, 0x56C, 0x568, 0x565, 0x561, 0x55E, 0x55A, 0x556,
+    0x553, 0x54F, 0x54C, 0x548, 0x545, 0x541, 0x53E, 0x53A,
+    0x537, 0x534, 0x530, 0x52D, 0x52A, 0x526, 0x523, 0x520,
+    0x51C, 0x519, 0x516, 0x513, 0x50F, 0x50C, 0x509, 0x506,
+    0x503, 0x500, 0x4FC, 0x4F9, 0x4F6, 0x4F3, 0x4F0, 0x4ED,
+    0x4EA, 0x4E7, 0x4E4, 0x4E1, 0x4DE, 0x4DB, 0x4D8, 0x4D5,
+    0x4D2, 0x4CF, 0x4CC, 0x4CA, 0x4C7, 0x4C4, 0x4C1, 0x4BE,
+    0x4BB, 0x4B9, 0x4B6, 0x4B3, 0x4B0, 0x4AD, 0x4AB, 0x4A8,
+    0x4A5, 0x4A3, 0x4A0, 0x49D, 0x49B, 0x498, 0x495, 0x493,
+    0x490, 0x48D, 0x48B, 0x488, 0x486, 0x483, 0x481, 0x47E,
+    0x47C, 0x479, 0x477, 0x474, 0x472, 0x46F, 0x46D, 0x46A,
+    0x468, 0x465, 0x463, 0x461, 0x45E, 0x45C, 0x459, 0x457,
+    0x455, 0x452, 0x450, 0x44E, 0x44B, 0x449, 0x447, 0x444,
+    0x442, 0x440, 0x43E, 0x43B, 0x439, 0x437, 0x435, 0x432,
+    0x430, 0x42E, 0x42C, 0x42A, 0x428, 0x425, 0x423, 0x421,
+    0x41F, 0x41D, 0x41B, 0x419, 0x417, 0x414, 0x412, 0x410,
+    0x40E, 0x40C, 0x40A, 0x408, 0x406, 0x404, 0x402, 0x400
+};
+
+/*----------------------------------------------------------------------------
+| Returns the reciprocal floor((2^128 - 1) / b) - 2^64 of the divisor `b',
+| which must be at least 2^63.  The 11-bit table seed is refined by two
+| Newton-Raphson steps to 21 and 34 bits and by a third, cubically converging
+| step to 64 bits; the final adjustment makes the result exact (Moller and
+| Granlund, "Improved division by invariant integers").
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE uint64_t reciprocal64(uint64_t b)
+{
+    uint64_t b0 = b & 1;
+    uint64_t b40 = (b>>24) + 1;
+    uint64_t b63 = (b>>1) + b0;
+    uint64_t v0 = reciprocal64_seed[(b>>55) - 256];
+    uint64_t v1 = (v0<<11) - ((v0 * v0 * b40)>>40) - 1;
+    uint64_t v2 = (v1<<13) + ((v1 * ((U64(1)<<60) - v1 * b40))>>47);
+    uint64_t e = ((v2>>1) & (0 - b0)) - v2 * b63;
+    uint64_t v3 = (v2<<31) + (uint64_t) (((uint128_native) v2 * e)>>65);
+    uint128_native p = (uint128_native) v3 * b + b;
+    return v3 - (uint64_t) (p>>64) - b;
+}
+
+/*----------------------------------------------------------------------------
+| Divides the 128-bit value formed by concatenating `a0' and `a1' by `b',
+| using the reciprocal `v' of `b' computed by `reciprocal64'.  The quotient,
+| truncated toward zero, is returned and the remainder is stored at the
+| location pointed to by `remPtr'.  The quotient estimate taken from the
+| product with the reciprocal is off by at most one in either direction and
+| is corrected by checking the exact remainder.  `a0' must be less than `b'.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE uint64_t div128By64To64Reciprocal(uint64_t a0, uint64_t a1, uint64_t b, uint64_t v, uint64_t *remPtr)
+{
+    uint128_native q = (uint128_native) v * a0 + pack128(a0, a1);
+    uint64_t q1 = (uint64_t) (q>>64) + 1;
+    uint64_t q0 = (uint64_t) q;
+    uint64_t r = a1 - q1 * b;
+    if (r > q0) {
+        --q1;
+        r += b;
+    }
+    if (r >= b) {
+        ++q1;
+        r -= b;
+    }
+    *remPtr = r;
+    return q1;
+}
+
+#endif
+
 /*----------------------------------------------------------------------------
 | Returns an approximation to the 64-bit integer quotient obtained by dividing
 | `b' into the 128-bit value formed by concatenating `a0' and `a1'.  The
@@ -281,6 +465,122 @@ static uint32_t estimateSqrt32(int16_t aExp, uint32_t a)
 }
 #endif
 
+#ifdef LIBX87_NATIVE_INT128
+
+/*----------------------------------------------------------------------------
+| 16-bit reciprocal square root seeds 2^15/sqrt((i + 1/2)/2^9) for the 384
+| values i of the nine leading bits of a 64-bit operand that is at least 2^62.
+*----------------------------------------------------------------------------*/
+
+static const uint16_t rsqrt64_seed[384] = {
+    0xFF80, 0xFE83, 0xFD89, 0xFC92, 0xFB9E, 0xFAAC, 0xF9BD, 0xF8D0,
+    0xF7E7, 0xF700, 0xF61B, 0xF539, 0xF459, 0xF37B, 0xF2A0, 0xF1C7,
+    0xF0F1, 0xF01D, 0xEF4A, 0xEE7A, 0xEDAD, 0xECE1, 0xEC17, 0xEB4F,
+    0xEA89, 0xE9C5, 0xE903, 0xE843, 0xE785, 0xE6C9, 0xE60E, 0xE555,
+    0xE49E, 0xE3E8, 0xE335, 0xE282, 0xE1D2, 0xE123, 0xE076, 0xDFCA,
+    0xDF20, 0xDE77, 0xDDD0, 0xDD2A, 0xDC85, 0xDBE3, 0xDB41, 0xDAA1,
+    0xDA02, 0xD965, 0xD8C9, 0xD82E, 0xD794, 0xD6FC, 0xD665, 0xD5CF,
+    0xD53B, 0xD4A7, 0xD415, 0xD384, 0xD2F4, 0xD266, 0xD1D8, 0xD14C,
+    0xD0C0, 0xD036, 0xCFAD, 0xCF25, 0xCE9E, 0xCE18, 0xCD93, 0xCD0E,
+    0xCC8B, 0xCC09, 0xCB88, 0xCB08, 0xCA89, 0xCA0A, 0xC98D, 0xC911,
+    0xC895, 0xC81A, 0xC7A0, 0xC728, 0xC6AF, 0xC638, 0xC5C2, 0xC54C,
+    0xC4D7, 0xC463, 0xC3F0, 0xC37E, 0xC30C, 0xC29B, 0xC22B, 0xC1BC,
+    0xC14D, 0xC0E0, 0xC072, 0xC006, 0xBF9A, 0xBF2F, 0xBEC5, 0xBE5B,
+    0xBDF3, 0xBD8A, 0xBD23, 0xBCBC, 0xBC56, 0xBBF0, 0xBB8B, 0xBB27,
+    0xBAC3, 0xBA60, 0xB9FD, 0xB99C, 0xB93A, 0xB8DA, 0xB879, 0xB81A,
+    0xB7BB, 0xB75D, 0xB6FF, 0xB6A2, 0xB645, 0xB5E9, 0xB58D, 0xB532,
+    0xB4D8, 0xB47E, 0xB424, 0xB3CB, 0xB373, 0xB31B, 0xB2C4, 0xB26D,
+    0xB216, 0xB1C0, 0xB16B, 0xB116, 0xB0C1, 0xB06D, 0xB01A, 0xAFC7,
+    0xAF74, 0xAF22, 0xAED0, 0xAE7F, 0xAE2E, 0xADDE, 0xAD8E, 0xAD3E,
+    0xACEF, 0xACA0, 0xAC52, 0xAC04, 0xABB7, 0xAB6A, 0xAB1D, 0xAAD1,
+    0xAA85, 0xAA39, 0xA9EE, 0xA9A4, 0xA959, 0xA90F, 0xA8C6, 0xA87D,
+    0xA834, 0xA7EB, 0xA7A3, 0xA75C, 0xA714, 0xA6CD, 0xA687, 0xA640,
+    0xA5FA, 0xA5B5, 0xA570, 0xA52B, 0xA4E6, 0xA4A2, 0xA45E, 0xA41A,
+    0xA3D7, 0xA394, 0xA351, 0xA30F, 0xA2CD, 0xA28B, 0xA24A, 0xA209,
+    0xA1C8, 0xA188, 0xA148, 0xA108, 0xA0C8, 0xA089, 0xA04A, 0xA00B,
+    0x9FCD, 0x9F8F, 0x9F51, 0x9F13, 0x9ED6, 0x9E99, 0x9E5C, 0x9E20,
+    0x9DE4, 0x9DA8, 0x9D6C, 0x9D31, 0x9CF6, 0x9CBB, 0x9C80, 0x9C46,
+    0x9C0C, 0x9BD2, 0x9B98, 0x9B5F, 0x9B26, 0x9AED, 0x9AB4, 0x9A7C,
+    0x9A44, 0x9A0C, 0x99D4, 0x999D, 0x9965, 0x992F, 0x98F8, 0x98C1,
+    0x988B, 0x9855, 0x981F, 0x97EA, 0x97B4, 0x977F, 0x974A, 0x9715,
+    0x96E1, 0x96AC, 0x9678, 0x9645, 0x9611, 0x95DD, 0x95AA, 0x9577,
+    0x9544, 0x9512, 0x94DF, 0x94AD, 0x947B, 0x9449, 0x9417, 0x93E6,
+    0x93B5, 0x9384, 0x9353, 0x9322, 0x92F1, 0x92C1, 0x9291, 0x9261,
+    0x9231, 0x9202, 0x91D2, 0x91A3, 0x9174, 0x9145, 0x9116, 0x90E8,
+    0x90BA, 0x908B, 0x905D, 0x9030, 0x9002, 0x8FD4, 0x8FA7, 0x8F7A,
+    0x8F4D, 0x8F20, 0x8EF4, 0x8EC7, 0x8E9B, 0x8E6F, 0x8E43, 0x8E17,
+    0x8DEB, 0x8DBF, 0x8D94, 0x8D69, 0x8D3E, 0x8D13, 0x8CE8, 0x8CBD,
+    0x8C93, 0x8C69, 0x8C3F, 0x8C15, 0x8BEB, 0x8BC1, 0x8B97, 0x8B6E,
+    0x8B45, 0x8B1C, 0x8AF3, 0x8ACA, 0x8AA1, 0x8A78, 0x8A50, 0x8A28,
+    0x89FF, 0x89D7, 0x89AF, 0x8988, 0x8960, 0x8939, 0x8911, 0x88EA,
+    0x88C3, 0x889C, 0x8875, 0x884E, 0x8828, 0x8801, 0x87DB, 0x87B5,
+    0x878F, 0x8769, 0x8743, 0x871D, 0x86F8, 0x86D2, 0x86AD, 0x8688,
+    0x8663, 0x863E, 0x8619, 0x85F4, 0x85CF, 0x85AB, 0x8587, 0x8562,
+    0x853E, 0x851A, 0x84F6, 0x84D2, 0x84AF, 0x848B, 0x8468, 0x8444,
+    0x8421, 0x83FE, 0x83DB, 0x83B8, 0x8395, 0x8372, 0x8350, 0x832D,
+    0x830B, 0x82E9, 0x82C6, 0x82A4, 0x8282, 0x8261, 0x823F, 0x821D,
+    0x81FC, 0x81DA, 0x81B9, 0x8197, 0x8176, 0x8155, 0x8134, 0x8113,
+    0x80F3, 0x80D2, 0x80B1, 0x8091, 0x8071, 0x8050, 0x8030, 0x8010
+};
+
+/*----------------------------------------------------------------------------
+| Returns an approximation to 2^62/sqrt(`a'/2^64), where `a' is considered an
+| integer and must be at least 2^62.  The 8-bit accurate table seed is refined
+| by three Newton-Raphson iterations y' = y*(3 - a*y^2)/2 carried out in 64-bit
+| fixed point, so that the relative error of the result is below 2^-57.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE uint64_t estimateRsqrt64(uint64_t a)
+{
+    uint64_t y = (uint64_t) rsqrt64_seed[(a>>55) - 128]<<47;
+    for (int i = 0; i < 3; i++) {
+        uint64_t y2 = (uint64_t) (((uint128_native) y * y)>>64);
+        uint64_t e = (uint64_t) (((uint128_native) a * y2)>>64);
+        y = (uint64_t) (((uint128_native) y * ((U64(3)<<60) - e))>>61);
+    }
+    return y;
+}
+
+#endif
+
+#ifdef LIBX87_CLZ_BUILTIN
+
+#ifdef FLOAT16
+
+/*----------------------------------------------------------------------------
+| Returns the number of leading 0 bits before the most-significant 1 bit of
+| `a'.  If `a' is zero, 16 is returned.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int countLeadingZeros16(uint16_t a)
+{
+    return a ? __builtin_clz(a) - 16 : 16;
+}
+
+#endif
+
+/*----------------------------------------------------------------------------
+| Returns the number of leading 0 bits before the most-significant 1 bit of
+| `a'.  If `a' is zero, 32 is returned.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int countLeadingZeros32(uint32_t a)
+{
+    return a ? __builtin_clz(a) : 32;
+}
+
+/*----------------------------------------------------------------------------
+| Returns the number of leading 0 bits before the most-significant 1 bit of
+| `a'.  If `a' is zero, 64 is returned.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int countLeadingZeros64(uint64_t a)
+{
+    return a ? __builtin_clzll(a) : 64;
+}
+
+#else
+
 static const int countLeadingZeros8[] = {
   8, 7, 6, 6, 5, 5, 5, 5, 4, 4, 4, 4, 4, 4, 4, 4,
   3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
@@ -358,6 +658,8 @@ BX_CPP_INLINE int countLeadingZeros64(uint64_t a)
     return shiftCount;
 }
 
+#endif
+
 #ifdef FLOATX80
 
 /*----------------------------------------------------------------------------
@@ -402,6 +704,18 @@ BX_CPP_INLINE void shift128Right(uint64_t a0, uint64_t a1, int count, uint64_t *
 
 BX_CPP_INLINE void shift128RightJamming(uint64_t a0, uint64_t a1, int count, uint64_t *z0Ptr, uint64_t *z1Ptr)
 {
+#ifdef LIBX87_NATIVE_INT128
+    uint128_native a = pack128(a0, a1), z;
+
+    if (count < 128) {
+        z = (a>>count) | ((count != 0) & ((a<<((-count) & 127)) != 0));
+    }
+    else {
+        z = (a != 0);
+    }
+    *z1Ptr = (uint64_t) z;
+    *z0Ptr = (uint64_t)(z>>64);
+#else
     uint64_t z0, z1;
     int negCount = (-count) & 63;
 
@@ -427,6 +741,7 @@ BX_CPP_INLINE void shift128RightJamming(uint64_t a0, uint64_t a1, int count, uin
     }
     *z1Ptr = z1;
     *z0Ptr = z0;
+#endif
 }
 
 /*----------------------------------------------------------------------------
@@ -462,6 +777,13 @@ BX_CPP_INLINE void add192(
      uint64_t *z2Ptr
 )
 {
+#ifdef LIBX87_NATIVE_INT128
+    uint128_native lo = (uint128_native) a2 + b2;
+    uint128_native hi = pack128(a0, a1) + pack128(b0, b1) + (uint64_t)(lo>>64);
+    *z2Ptr = (uint64_t) lo;
+    *z1Ptr = (uint64_t) hi;
+    *z0Ptr = (uint64_t)(hi>>64);
+#else
     uint64_t z0, z1, z2;
     unsigned carry0, carry1;
 
@@ -476,6 +798,7 @@ BX_CPP_INLINE void add192(
     *z2Ptr = z2;
     *z1Ptr = z1;
     *z0Ptr = z0;
+#endif
 }
 
 /*----------------------------------------------------------------------------
@@ -498,6 +821,12 @@ BX_CPP_INLINE void sub192(
      uint64_t *z2Ptr
 )
 {
+#ifdef LIBX87_NATIVE_INT128
+    uint128_native hi = pack128(a0, a1) - pack128(b0, b1) - (a2 < b2);
+    *z2Ptr = a2 - b2;
+    *z1Ptr = (uint64_t) hi;
+    *z0Ptr = (uint64_t)(hi>>64);
+#else
     uint64_t z0, z1, z2;
     unsigned borrow0, borrow1;
 
@@ -512,6 +841,7 @@ BX_CPP_INLINE void sub192(
     *z2Ptr = z2;
     *z1Ptr = z1;
     *z0Ptr = z0;
+#endif
 }
 
 /*----------------------------------------------------------------------------
@@ -565,6 +895,13 @@ BX_CPP_INLINE void mul128By64To192(
      uint64_t *z2Ptr
 )
 {
+#ifdef LIBX87_NATIVE_INT128
+    uint128_native lo = (uint128_native) a1 * b;
+    uint128_native hi = (uint128_native) a0 * b + (uint64_t)(lo>>64);
+    *z2Ptr = (uint64_t) lo;
+    *z1Ptr = (uint64_t) hi;
+    *z0Ptr = (uint64_t)(hi>>64);
+#else
     uint64_t z0, z1, z2, more1;
 
     mul64To128(a1, b, &z1, &z2);
@@ -573,6 +910,7 @@ BX_CPP_INLINE void mul128By64To192(
     *z2Ptr = z2;
     *z1Ptr = z1;
     *z0Ptr = z0;
+#endif
 }
 
 #ifdef FLOAT128
@@ -595,6 +933,18 @@ BX_CPP_INLINE void mul128To256(
      uint64_t *z3Ptr
 )
 {
+#ifdef LIBX87_NATIVE_INT128
+    uint128_native p11 = (uint128_native) a1 * b1;
+    uint128_native p10 = (uint128_native) a1 * b0;
+    uint128_native p01 = (uint128_native) a0 * b1;
+    uint128_native p00 = (uint128_native) a0 * b0;
+    uint128_native mid = (uint128_native)(uint64_t) p10 + (uint64_t) p01 + (uint64_t)(p11>>64);
+    uint128_native hi = p00 + (uint64_t)(p10>>64) + (uint64_t)(p01>>64) + (uint64_t)(mid>>64);
+    *z3Ptr = (uint64_t) p11;
+    *z2Ptr = (uint64_t) mid;
+    *z1Ptr = (uint64_t) hi;
+    *z0Ptr = (uint64_t)(hi>>64);
+#else
     uint64_t z0, z1, z2, z3;
     uint64_t more1, more2;
 
@@ -610,6 +960,7 @@ BX_CPP_INLINE void mul128To256(
     *z2Ptr = z2;
     *z1Ptr = z1;
     *z0Ptr = z0;
+#endif
 }
 
 
@@ -0,0 +1,234 @@
+/*============================================================================
+This C++ header file is an extension to the SoftFloat IEC/IEEE Floating-point
+Arithmetic Package, Release 2b, written for libx87.
+
+THIS SOFTWARE IS DISTRIBUTED AS IS, FOR FREE.  Although reasonable effort has
+been made to avoid it, THIS SOFTWARE MAY CONTAIN FAULTS THAT WILL AT TIMES
+RESULT IN INCORRECT BEHAVIOR.  USE OF THIS SOFTWARE IS RESTRICTED TO PERSONS
+AND ORGANIZATIONS WHO CAN AND WILL TAKE FULL RESPONSIBILITY FOR ALL LOSSES,
+COSTS, OR OTHER PROBLEMS THEY INCUR DUE TO THE SOFTWARE, AND WHO FURTHERMORE
+EFFECTIVELY INDEMNIFY JOHN HAUSER AND THE INTERNATIONAL COMPUTER SCIENCE
+INSTITUTE (possibly via similar legal warning) AGAINST ALL LOSSES, COSTS, OR
+OTHER PROBLEMS INCURRED BY THEIR CUSTOMERS AND CLIENTS DUE TO THE SOFTWARE.
+
+Derivative works are acceptable, even for commercial purposes, so long as
+(1) the source code for the derivative work includes prominent notice that
+the work is derivative, and (2) the source code includes prominent notice with
+these four paragraphs for those parts of this code that are retained.
+=============================================================================*/
+
+#ifndef SOFTFLOAT_POLY_H_
+#define SOFTFLOAT_POLY_H_
+
+/*============================================================================
+ * Coefficient tables of the polynomial kernels of the transcendental
+ * instructions.  They are constant expressions, so they end up in read-only
+ * data rather than in writable, per-process pages.
+ *
+ * The float128 tables hold the Taylor coefficients evaluated by `EvalPoly',
+ * `EvenPoly' and `OddPoly' in the approximations that work in quadruple
+ * precision.  The fixed-point tables hold the coefficients, lowest order
+ * first, of the correction polynomials of the table-driven kernels in
+ * Q4.124, as read by `EvalPolyFixedEstrin'.
+ *
+ * Like the other softfloat headers, this header is included from inside
+ * namespace libx87.
+ * ==========================================================================*/
+
+#define SIN_ARR_SIZE 11
+#define COS_ARR_SIZE 11
+#define L2_ARR_SIZE 9
+#define FPATAN_ARR_SIZE 11
+#define EXP_ARR_SIZE 15
+
+// bound on the sizes above, for the evaluators' scratch space
+#define EVAL_POLY_MAX_SIZE 16
+
+// sin(x)/x in x^2
+constexpr float128 sin_arr[SIN_ARR_SIZE] =
+        {
+                PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
+                PACK_FLOAT_128(0xbffc555555555555, 0x5555555555555555), /*  3 */
+                PACK_FLOAT_128(0x3ff8111111111111, 0x1111111111111111), /*  5 */
+                PACK_FLOAT_128(0xbff2a01a01a01a01, 0xa01a01a01a01a01a), /*  7 */
+                PACK_FLOAT_128(0x3fec71de3a556c73, 0x38faac1c88e50017), /*  9 */
+                PACK_FLOAT_128(0xbfe5ae64567f544e, 0x38fe747e4b837dc7), /* 11 */
+                PACK_FLOAT_128(0x3fde6124613a86d0, 0x97ca38331d23af68), /* 13 */
+                PACK_FLOAT_128(0xbfd6ae7f3e733b81, 0xf11d8656b0ee8cb0), /* 15 */
+                PACK_FLOAT_128(0x3fce952c77030ad4, 0xa6b2605197771b00), /* 17 */
+                PACK_FLOAT_128(0xbfc62f49b4681415, 0x724ca1ec3b7b9675), /* 19 */
+                PACK_FLOAT_128(0x3fbd71b8ef6dcf57, 0x18bef146fcee6e45)  /* 21 */
+        };
+
+// cos(x) in x^2
+constexpr float128 cos_arr[COS_ARR_SIZE] =
+        {
+                PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  0 */
+                PACK_FLOAT_128(0xbffe000000000000, 0x0000000000000000), /*  2 */
+                PACK_FLOAT_128(0x3ffa555555555555, 0x5555555555555555), /*  4 */
+                PACK_FLOAT_128(0xbff56c16c16c16c1, 0x6c16c16c16c16c17), /*  6 */
+                PACK_FLOAT_128(0x3fefa01a01a01a01, 0xa01a01a01a01a01a), /*  8 */
+                PACK_FLOAT_128(0xbfe927e4fb7789f5, 0xc72ef016d3ea6679), /* 10 */
+                PACK_FLOAT_128(0x3fe21eed8eff8d89, 0x7b544da987acfe85), /* 12 */
+                PACK_FLOAT_128(0xbfda93974a8c07c9, 0xd20badf145dfa3e5), /* 14 */
+                PACK_FLOAT_128(0x3fd2ae7f3e733b81, 0xf11d8656b0ee8cb0), /* 16 */
+                PACK_FLOAT_128(0xbfca6827863b97d9, 0x77bb004886a2c2ab), /* 18 */
+                PACK_FLOAT_128(0x3fc1e542ba402022, 0x507a9cad2bf8f0bb)  /* 20 */
+        };
+
+// artanh(u)/u in u^2
+constexpr float128 ln_arr[L2_ARR_SIZE] =
+        {
+                PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
+                PACK_FLOAT_128(0x3ffd555555555555, 0x5555555555555555), /*  3 */
+                PACK_FLOAT_128(0x3ffc999999999999, 0x999999999999999a), /*  5 */
+                PACK_FLOAT_128(0x3ffc249249249249, 0x2492492492492492), /*  7 */
+                PACK_FLOAT_128(0x3ffbc71c71c71c71, 0xc71c71c71c71c71c), /*  9 */
+                PACK_FLOAT_128(0x3ffb745d1745d174, 0x5d1745d1745d1746), /* 11 */
+                PACK_FLOAT_128(0x3ffb3b13b13b13b1, 0x3b13b13b13b13b14), /* 13 */
+                PACK_FLOAT_128(0x3ffb111111111111, 0x1111111111111111), /* 15 */
+                PACK_FLOAT_128(0x3ffae1e1e1e1e1e1, 0xe1e1e1e1e1e1e1e2)  /* 17 */
+        };
+
+// atan(x)/x in x^2
+constexpr float128 atan_arr[FPATAN_ARR_SIZE] =
+        {
+                PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
+                PACK_FLOAT_128(0xbffd555555555555, 0x5555555555555555), /*  3 */
+                PACK_FLOAT_128(0x3ffc999999999999, 0x999999999999999a), /*  5 */
+                PACK_FLOAT_128(0xbffc249249249249, 0x2492492492492492), /*  7 */
+                PACK_FLOAT_128(0x3ffbc71c71c71c71, 0xc71c71c71c71c71c), /*  9 */
+                PACK_FLOAT_128(0xbffb745d1745d174, 0x5d1745d1745d1746), /* 11 */
+                PACK_FLOAT_128(0x3ffb3b13b13b13b1, 0x3b13b13b13b13b14), /* 13 */
+                PACK_FLOAT_128(0xbffb111111111111, 0x1111111111111111), /* 15 */
+                PACK_FLOAT_128(0x3ffae1e1e1e1e1e1, 0xe1e1e1e1e1e1e1e2), /* 17 */
+                PACK_FLOAT_128(0xbffaaf286bca1af2, 0x86bca1af286bca1b), /* 19 */
+                PACK_FLOAT_128(0x3ffa861861861861, 0x8618618618618618)  /* 21 */
+        };
+
+// (e^x - 1)/x in x
+constexpr float128 exp_arr[EXP_ARR_SIZE] =
+        {
+                PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
+                PACK_FLOAT_128(0x3ffe000000000000, 0x0000000000000000), /*  2 */
+                PACK_FLOAT_128(0x3ffc555555555555, 0x5555555555555555), /*  3 */
+                PACK_FLOAT_128(0x3ffa555555555555, 0x5555555555555555), /*  4 */
+                PACK_FLOAT_128(0x3ff8111111111111, 0x1111111111111111), /*  5 */
+                PACK_FLOAT_128(0x3ff56c16c16c16c1, 0x6c16c16c16c16c17), /*  6 */
+                PACK_FLOAT_128(0x3ff2a01a01a01a01, 0xa01a01a01a01a01a), /*  7 */
+                PACK_FLOAT_128(0x3fefa01a01a01a01, 0xa01a01a01a01a01a), /*  8 */
+                PACK_FLOAT_128(0x3fec71de3a556c73, 0x38faac1c88e50017), /*  9 */
+                PACK_FLOAT_128(0x3fe927e4fb7789f5, 0xc72ef016d3ea6679), /* 10 */
+                PACK_FLOAT_128(0x3fe5ae64567f544e, 0x38fe747e4b837dc7), /* 11 */
+                PACK_FLOAT_128(0x3fe21eed8eff8d89, 0x7b544da987acfe85), /* 12 */
+                PACK_FLOAT_128(0x3fde6124613a86d0, 0x97ca38331d23af68), /* 13 */
+                PACK_FLOAT_128(0x3fda93974a8c07c9, 0xd20badf145dfa3e5), /* 14 */
+                PACK_FLOAT_128(0x3fd6ae7f3e733b81, 0xf11d8656b0ee8cb0)  /* 15 */
+        };
+
+#ifdef LIBX87_NATIVE_INT128
+
+#define PACK_FIXED_128(hi,lo) ((int128_native) ((uint128_native) U64(hi) << 64 | U64(lo)))
+
+#define SINCOS_POLY_SIZE 6
+#define TAN_POLY_SIZE 8
+#define LOG2_POLY_SIZE 12
+#define ATAN_POLY_SIZE 8
+#define EXP2_POLY_SIZE 12
+
+// sin(d)/d and cos(d) in d^2
+constexpr int128_native sin_poly_fixed[SINCOS_POLY_SIZE] =
+        {
+                PACK_FIXED_128(0x1000000000000000, 0x0000000000000000), /* 1 */
+                PACK_FIXED_128(0xfd55555555555555, 0x5555555555555555), /* -1/6 */
+                PACK_FIXED_128(0x0022222222222222, 0x2222222222222222), /* 1/120 */
+                PACK_FIXED_128(0xffff2ff2ff2ff2ff, 0x2ff2ff2ff2ff2ff3), /* -1/5040 */
+                PACK_FIXED_128(0x000002e3bc74aad8, 0xe671f5583911ca00), /* 1/362880 */
+                PACK_FIXED_128(0xfffffff9466ea602, 0xaec71c062e06d1f2)  /* -1/39916800 */
+        };
+
+constexpr int128_native cos_poly_fixed[SINCOS_POLY_SIZE] =
+        {
+                PACK_FIXED_128(0x1000000000000000, 0x0000000000000000), /* 1 */
+                PACK_FIXED_128(0xf800000000000000, 0x0000000000000000), /* -1/2 */
+                PACK_FIXED_128(0x00aaaaaaaaaaaaaa, 0xaaaaaaaaaaaaaaab), /* 1/24 */
+                PACK_FIXED_128(0xfffa4fa4fa4fa4fa, 0x4fa4fa4fa4fa4fa5), /* -1/720 */
+                PACK_FIXED_128(0x00001a01a01a01a0, 0x1a01a01a01a01a02), /* 1/40320 */
+                PACK_FIXED_128(0xffffffb606c1221d, 0x828e3443fa4b0566)  /* -1/3628800 */
+        };
+
+// tan(r)/r and r*cot(r) in r^2
+constexpr int128_native tan_poly_fixed[TAN_POLY_SIZE] =
+        {
+                PACK_FIXED_128(0x1000000000000000, 0x0000000000000000), /* 1 */
+                PACK_FIXED_128(0x0555555555555555, 0x5555555555555555), /* 1/3 */
+                PACK_FIXED_128(0x0222222222222222, 0x2222222222222222), /* 2/15 */
+                PACK_FIXED_128(0x00dd0dd0dd0dd0dd, 0x0dd0dd0dd0dd0dd1), /* 17/315 */
+                PACK_FIXED_128(0x005993d220b043e7, 0xccb5aee927760599), /* 62/2835 */
+                PACK_FIXED_128(0x00244dc6abcd8479, 0x1eb6a3872e9f6404), /* 1382/155925 */
+                PACK_FIXED_128(0x000eb69e870abeef, 0xdafe606d2e4d1e66), /* 21844/6081075 */
+                PACK_FIXED_128(0x0005f68d914add78, 0xada8764d7a2d130d)  /* 929569/638512875 */
+        };
+
+constexpr int128_native cot_poly_fixed[TAN_POLY_SIZE] =
+        {
+                PACK_FIXED_128(0x1000000000000000, 0x0000000000000000), /* 1 */
+                PACK_FIXED_128(0xfaaaaaaaaaaaaaaa, 0xaaaaaaaaaaaaaaab), /* -1/3 */
+                PACK_FIXED_128(0xffa4fa4fa4fa4fa4, 0xfa4fa4fa4fa4fa50), /* -1/45 */
+                PACK_FIXED_128(0xfff754caa1ff754c, 0xaa1ff754caa1ff75), /* -2/945 */
+                PACK_FIXED_128(0xffff221443665887, 0xaa9ccbeee1103325), /* -1/4725 */
+                PACK_FIXED_128(0xffffe99570d408f1, 0x425d69eec1667c1e), /* -2/93555 */
+                PACK_FIXED_128(0xfffffdbaff45377b, 0x302116a73200360d), /* -1382/638512875 */
+                PACK_FIXED_128(0xffffffc5249a763e, 0xdd3c08f6a225cf63)  /* -4/18243225 */
+        };
+
+// log2(1 + u)/u in u
+constexpr int128_native log2p1_poly_fixed[LOG2_POLY_SIZE] =
+        {
+                PACK_FIXED_128(0x171547652b82fe17, 0x77d0ffda0d23a7d1), /* 1/(1 ln2) */
+                PACK_FIXED_128(0xf4755c4d6a3e80f4, 0x44178012f96e2c17), /* -1/(2 ln2) */
+                PACK_FIXED_128(0x07b1c2770e80ff5d, 0x27f05548af0be29b), /* 1/(3 ln2) */
+                PACK_FIXED_128(0xfa3aae26b51f407a, 0x220bc0097cb7160c), /* -1/(4 ln2) */
+                PACK_FIXED_128(0x049ddb143be6ff9e, 0x4b29ccc535d3ee5d), /* 1/(5 ln2) */
+                PACK_FIXED_128(0xfc271ec478bf8051, 0x6c07d55ba87a0eb2), /* -1/(6 ln2) */
+                PACK_FIXED_128(0x034c2ec54f5bdb27, 0xec8b9243b8bbf367), /* 1/(7 ln2) */
+                PACK_FIXED_128(0xfd1d57135a8fa03d, 0x1105e004be5b8b06), /* -1/(8 ln2) */
+                PACK_FIXED_128(0x02909627af80551f, 0x0d501c6d8faea0de), /* 1/(9 ln2) */
+                PACK_FIXED_128(0xfdb11275e20c8030, 0xda6b199d651608d1), /* -1/(10 ln2) */
+                PACK_FIXED_128(0x02193509328045a5, 0x0ae47459a41a839f), /* 1/(11 ln2) */
+                PACK_FIXED_128(0xfe138f623c5fc028, 0xb603eaadd43d0759)  /* -1/(12 ln2) */
+        };
+
+// atan(t)/t in t^2
+constexpr int128_native atan_poly_fixed[ATAN_POLY_SIZE] =
+        {
+                PACK_FIXED_128(0x1000000000000000, 0x0000000000000000), /* 1/1 */
+                PACK_FIXED_128(0xfaaaaaaaaaaaaaaa, 0xaaaaaaaaaaaaaaab), /* -1/3 */
+                PACK_FIXED_128(0x0333333333333333, 0x3333333333333333), /* 1/5 */
+                PACK_FIXED_128(0xfdb6db6db6db6db6, 0xdb6db6db6db6db6e), /* -1/7 */
+                PACK_FIXED_128(0x01c71c71c71c71c7, 0x1c71c71c71c71c72), /* 1/9 */
+                PACK_FIXED_128(0xfe8ba2e8ba2e8ba2, 0xe8ba2e8ba2e8ba2f), /* -1/11 */
+                PACK_FIXED_128(0x013b13b13b13b13b, 0x13b13b13b13b13b1), /* 1/13 */
+                PACK_FIXED_128(0xfeeeeeeeeeeeeeee, 0xeeeeeeeeeeeeeeef)  /* -1/15 */
+        };
+
+// (e^t - 1)/t in t
+constexpr int128_native expm1_poly_fixed[EXP2_POLY_SIZE] =
+        {
+                PACK_FIXED_128(0x1000000000000000, 0x0000000000000000), /* 1/1! */
+                PACK_FIXED_128(0x0800000000000000, 0x0000000000000000), /* 1/2! */
+                PACK_FIXED_128(0x02aaaaaaaaaaaaaa, 0xaaaaaaaaaaaaaaab), /* 1/3! */
+                PACK_FIXED_128(0x00aaaaaaaaaaaaaa, 0xaaaaaaaaaaaaaaab), /* 1/4! */
+                PACK_FIXED_128(0x0022222222222222, 0x2222222222222222), /* 1/5! */
+                PACK_FIXED_128(0x0005b05b05b05b05, 0xb05b05b05b05b05b), /* 1/6! */
+                PACK_FIXED_128(0x0000d00d00d00d00, 0xd00d00d00d00d00d), /* 1/7! */
+                PACK_FIXED_128(0x00001a01a01a01a0, 0x1a01a01a01a01a02), /* 1/8! */
+                PACK_FIXED_128(0x000002e3bc74aad8, 0xe671f5583911ca00), /* 1/9! */
+                PACK_FIXED_128(0x00000049f93edde2, 0x7d71cbbc05b4fa9a), /* 1/10! */
+                PACK_FIXED_128(0x00000006b99159fd, 0x5138e3f9d1f92e0e), /* 1/11! */
+                PACK_FIXED_128(0x000000008f76c77f, 0xc6c4bdaa26d4c3d6)  /* 1/12! */
+        };
+
+#endif  /* LIBX87_NATIVE_INT128 */
+
+#endif
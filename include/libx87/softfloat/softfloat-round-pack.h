@@ -247,6 +247,22 @@ floatx80 roundAndPackFloatx80(int roundingPrecision,
 | normalized.
 *----------------------------------------------------------------------------*/
 
+floatx80 normalizeRoundAndPackFloatx80(int roundingPrecision,
+        int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1, float_status_t *status);
+
+/*----------------------------------------------------------------------------
+| Variants of `roundAndPackFloatx80' and `normalizeRoundAndPackFloatx80' with
+| the rounding precision `rp' (32, 64 or 80) and the rounding mode `rm' fixed
+| at compile time, so that they do not dispatch on the rounding configuration.
+| An `rp' of 0 takes the precision from `roundingPrecision' and an `rm' of -1
+| takes the rounding mode from the status word, as the routines above do.
+*----------------------------------------------------------------------------*/
+
+template <int rp, int rm>
+floatx80 roundAndPackFloatx80(int roundingPrecision,
+        int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1, float_status_t *status);
+
+template <int rp, int rm>
 floatx80 normalizeRoundAndPackFloatx80(int roundingPrecision,
         int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1, float_status_t *status);
 
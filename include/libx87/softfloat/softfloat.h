@@ -209,6 +209,18 @@ BX_CPP_INLINE void set_float_rounding_up(float_status_t *status)
     status->float_exception_flags |= RAISE_SW_C1;
 }
 
+/*----------------------------------------------------------------------------
+| Returns 1 if an unmasked underflow or overflow exception is already pending
+| in `status'.  roundAndPackFloatx80 then re-biases every result it produces,
+| so the floatx80 fast paths, which do not round through it, must not be used.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int floatx80_range_trap_pending(const float_status_t *status)
+{
+    return (status->float_exception_flags & ~status->float_exception_masks
+                & (float_flag_underflow | float_flag_overflow)) != 0;
+}
+
 /*----------------------------------------------------------------------------
 | Returns 1 if the <denormals-are-zeros> feature is supported;
 | otherwise returns 0.
@@ -448,6 +460,145 @@ floatx80 floatx80_mul(floatx80, floatx80, float_status_t *status);
 floatx80 floatx80_div(floatx80, floatx80, float_status_t *status);
 floatx80 floatx80_sqrt(floatx80, float_status_t *status);
 
+/*----------------------------------------------------------------------------
+| Rounding and exception configuration passed by value to the register-based
+| extended double-precision arithmetic below.  The fields have the meaning of
+| the corresponding `float_status_t' fields; flush-to-zero, denormals-are-
+| zeros and exception suppression are off.
+*----------------------------------------------------------------------------*/
+typedef struct {
+    uint8_t rounding_precision;
+    uint8_t rounding_mode;
+    uint8_t exception_masks;
+    uint8_t nan_handling_mode;
+} float_config_t;
+
+BX_CPP_INLINE constexpr float_config_t float_config_from_status(const float_status_t *status)
+{
+    float_config_t config = {};
+    config.rounding_precision = (uint8_t) status->float_rounding_precision;
+    config.rounding_mode = (uint8_t) status->float_rounding_mode;
+    config.exception_masks = (uint8_t) status->float_exception_masks;
+    config.nan_handling_mode = (uint8_t) status->float_nan_handling_mode;
+    return config;
+}
+
+BX_CPP_INLINE constexpr void float_config_to_status(float_config_t config, float_status_t *status)
+{
+    status->float_rounding_precision = config.rounding_precision;
+    status->float_rounding_mode = config.rounding_mode;
+    status->float_exception_flags = 0;
+    status->float_exception_masks = config.exception_masks;
+    status->float_suppress_exception = 0;
+    status->float_nan_handling_mode = config.nan_handling_mode;
+    status->flush_underflow_to_zero = 0;
+    status->denormals_are_zeros = 0;
+}
+
+/*----------------------------------------------------------------------------
+| Result of the register-based extended double-precision arithmetic:  the
+| value and the exception flags raised while computing it (including
+| RAISE_SW_C1).  It fits in two registers, so that it is returned in them
+| rather than through memory.
+*----------------------------------------------------------------------------*/
+typedef struct {
+    uint64_t fraction;
+    uint16_t exp;
+    uint16_t flags;
+} floatx80_result;
+
+BX_CPP_INLINE constexpr floatx80 floatx80_result_value(floatx80_result r)
+{
+    floatx80 z = {};
+    z.fraction = r.fraction;
+    z.exp = r.exp;
+    return z;
+}
+
+BX_CPP_INLINE constexpr floatx80_result floatx80_make_result(floatx80 z, const float_status_t *status)
+{
+    floatx80_result r = {};
+    r.fraction = z.fraction;
+    r.exp = z.exp;
+    r.flags = (uint16_t) status->float_exception_flags;
+    return r;
+}
+
+/*----------------------------------------------------------------------------
+| Register-based extended double-precision arithmetic:  the rounding and
+| exception configuration is taken by value and the exception flags are
+| returned with the result instead of being accumulated in a status word.
+*----------------------------------------------------------------------------*/
+floatx80_result floatx80_add_r(floatx80, floatx80, float_config_t config);
+floatx80_result floatx80_sub_r(floatx80, floatx80, float_config_t config);
+floatx80_result floatx80_mul_r(floatx80, floatx80, float_config_t config);
+floatx80_result floatx80_div_r(floatx80, floatx80, float_config_t config);
+floatx80_result floatx80_sqrt_r(floatx80, float_config_t config);
+
+/*----------------------------------------------------------------------------
+| Extended double-precision arithmetic specialised for one rounding precision
+| and rounding mode, in the status word and in the register-based form.  The
+| functions ignore the rounding precision and rounding mode held in the
+| status word or configuration and use the ones they were selected for.
+*----------------------------------------------------------------------------*/
+typedef floatx80 (*floatx80_binary_op)(floatx80, floatx80, float_status_t *status);
+typedef floatx80 (*floatx80_unary_op)(floatx80, float_status_t *status);
+typedef floatx80_result (*floatx80_binary_result_op)(floatx80, floatx80, float_config_t config);
+typedef floatx80_result (*floatx80_unary_result_op)(floatx80, float_config_t config);
+
+typedef struct {
+    floatx80_binary_op add, sub, mul, div;
+    floatx80_unary_op sqrt;
+    floatx80_binary_result_op add_r, sub_r, mul_r, div_r;
+    floatx80_unary_result_op sqrt_r;
+} floatx80_rounding_ops;
+
+const floatx80_rounding_ops *floatx80_get_rounding_ops(int roundingPrecision, int roundingMode);
+
+/*----------------------------------------------------------------------------
+| Register-based x87 arithmetic on an extended double-precision value and a
+| memory operand, which is consumed in its own format instead of being
+| converted to the extended double-precision format first.  The operations
+| are indexed by the reg field of the D8/DA/DC/DE instructions (FADD, FMUL,
+| FCOM, FCOMP, FSUB, FSUBR, FDIV, FDIVR); the FCOM entries are null.  The
+| 16-bit integer operands of the DE group are passed sign-extended to the
+| 32-bit integer operations.  They are specialised like
+| `floatx80_rounding_ops'.
+*----------------------------------------------------------------------------*/
+typedef floatx80_result (*floatx80_float32_result_op)(floatx80, float32, float_config_t config);
+typedef floatx80_result (*floatx80_int32_result_op)(floatx80, int32_t, float_config_t config);
+typedef floatx80_result (*floatx80_float64_result_op)(floatx80, float64, float_config_t config);
+
+typedef struct {
+    floatx80_float32_result_op float32_op[8];
+    floatx80_int32_result_op int32_op[8];
+    floatx80_float64_result_op float64_op[8];
+} floatx80_memory_ops;
+
+const floatx80_memory_ops *floatx80_get_memory_ops(int roundingPrecision, int roundingMode);
+
+/*----------------------------------------------------------------------------
+| Adapters giving the register-based form of an operation `op' that takes a
+| status word.  They are constexpr when `op' is.
+*----------------------------------------------------------------------------*/
+template <floatx80 (*op)(floatx80, floatx80, float_status_t *)>
+constexpr floatx80_result floatx80_binary_result(floatx80 a, floatx80 b, float_config_t config)
+{
+    float_status_t status = {};
+    float_config_to_status(config, &status);
+    floatx80 z = op(a, b, &status);
+    return floatx80_make_result(z, &status);
+}
+
+template <floatx80 (*op)(floatx80, float_status_t *)>
+constexpr floatx80_result floatx80_unary_result(floatx80 a, float_config_t config)
+{
+    float_status_t status = {};
+    float_config_to_status(config, &status);
+    floatx80 z = op(a, &status);
+    return floatx80_make_result(z, &status);
+}
+
 float_class_t floatx80_class(floatx80);
 //int floatx80_is_signaling_nan(floatx80);
 //int floatx80_is_nan(floatx80);
@@ -498,8 +649,8 @@ static inline void floatx80_repack(floatx80* st, uint16_t expdest, uint64_t sigd
 }
 
 // Halfix-specific defines
-inline static floatx80 BUILD_FLOAT_X80(uint16_t e, uint64_t s) {
-    floatx80 r;
+inline static constexpr floatx80 BUILD_FLOAT_X80(uint16_t e, uint64_t s) {
+    floatx80 r = {};
     r.fraction = s;
     r.exp = e;
     return r;
@@ -45,6 +45,22 @@ floatx80 floatx80_extract(floatx80 *a, float_status_t *status);
 floatx80 floatx80_scale(floatx80 a, floatx80 b, float_status_t *status);
 int floatx80_remainder(floatx80 a, floatx80 b, floatx80 *r, uint64_t *q, float_status_t *status);
 int floatx80_ieee754_remainder(floatx80 a, floatx80 b, floatx80 *r, uint64_t *q, float_status_t *status);
+
+/*----------------------------------------------------------------------------
+| Normal divisor of a partial remainder reduction, unpacked together with its
+| reciprocal, for the steps that FPREM and FPREM1 take while the exponents
+| of the operands are 64 or more apart.
+*----------------------------------------------------------------------------*/
+
+typedef struct {
+    uint64_t sig;
+    uint64_t recip;
+    int32_t exp;
+} floatx80_remainder_divisor;
+
+int floatx80_remainder_divisor_init(floatx80 b, floatx80_remainder_divisor *d);
+int floatx80_remainder_partial(floatx80 a, const floatx80_remainder_divisor *d, floatx80 *r);
+
 floatx80 f2xm1(floatx80 a, float_status_t *status);
 floatx80 fyl2x(floatx80 a, floatx80 b, float_status_t *status);
 floatx80 fyl2xp1(floatx80 a, floatx80 b, float_status_t *status);
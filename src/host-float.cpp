@@ -0,0 +1,394 @@
+// Host float/double execution backend for the basic extended double-precision
+// arithmetic, see libx87/host-float.h.
+
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+#include <math.h>
+
+namespace libx87 {
+
+#include "libx87/softfloat/softfloat.h"
+#include "libx87/softfloat/softfloat-specialize.h"
+#include "libx87/host-float.h"
+
+static thread_local floatx80_host_float_counters host_float_counters;
+
+floatx80_host_float_counters floatx80_get_host_float_counters(void) {
+    return host_float_counters;
+}
+
+void floatx80_reset_host_float_counters(void) {
+    host_float_counters.hits = 0;
+    host_float_counters.misses = 0;
+}
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0 && DBL_MANT_DIG == 53 && FLT_MANT_DIG == 24
+
+/*----------------------------------------------------------------------------
+| Biased double-precision exponents of the operands and results accepted when
+| rounding to `rp' bits.  For 32 they keep the value a normal single-
+| precision number, for 64 they keep the error-free transformations below
+| free of overflow and underflow; both leave room for the one-ulp steps of
+| the directed rounding modes.
+*----------------------------------------------------------------------------*/
+
+template <int rp>
+struct host_float_range {
+    static const uint32_t min = (rp == 32) ? 0x3FF - 120 : 0x3FF - 900;
+    static const uint32_t max = (rp == 32) ? 0x3FF + 120 : 0x3FF + 900;
+};
+
+/*----------------------------------------------------------------------------
+| Returns 1 if the double-precision value `x' is an operand the host path
+| accepts when rounding to `rp' bits:  its exponent is in range and, for 32,
+| it is exactly representable in single precision.
+*----------------------------------------------------------------------------*/
+
+template <int rp>
+static inline int host_float_operand(double x)
+{
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    uint32_t exp = (uint32_t) (bits >> 52) & 0x7FF;
+    if (exp - host_float_range<rp>::min > host_float_range<rp>::max - host_float_range<rp>::min) return 0;
+    return rp != 32 || (bits & 0x1FFFFFFF) == 0;
+}
+
+/*----------------------------------------------------------------------------
+| Stores in `x' the double-precision value of `a' and returns 1 if `a' is a
+| normalized extended double-precision value that `host_float_operand'
+| accepts.
+*----------------------------------------------------------------------------*/
+
+template <int rp>
+static inline int host_float_from_floatx80(floatx80 a, double *x)
+{
+    int32_t exp = (a.exp & 0x7FFF) - 0x3FFF + 0x3FF;
+    if ((uint32_t) exp - 1 >= 0x7FE || (int64_t) a.fraction >= 0 || (a.fraction & 0x7FF)) return 0;
+    uint64_t bits = (uint64_t) (a.exp & 0x8000) << 48 | (uint64_t) exp << 52 | (a.fraction << 1) >> 12;
+    memcpy(x, &bits, sizeof(bits));
+    return host_float_operand<rp>(*x);
+}
+
+/*----------------------------------------------------------------------------
+| Returns the sign (-1, 0 or 1) of `x'.
+*----------------------------------------------------------------------------*/
+
+static inline int host_float_sign(double x)
+{
+    return (x > 0) - (x < 0);
+}
+
+/*----------------------------------------------------------------------------
+| Returns the rounding error `a' * `b' - `p' of the double-precision product
+| `p' of `a' and `b', computed exactly by a fused multiply-add or by
+| Dekker's product.  This file is compiled without floating-point
+| contraction, which would break the latter.
+*----------------------------------------------------------------------------*/
+
+static inline double host_float_product_error(double a, double b, double p)
+{
+#ifdef FP_FAST_FMA
+    return fma(a, b, -p);
+#else
+    const double split = 134217729.0; // 2^27 + 1
+    double t = split * a;
+    double aHi = t - (t - a), aLo = a - aHi;
+    t = split * b;
+    double bHi = t - (t - b), bLo = b - bHi;
+    return ((aHi * bHi - p) + aHi * bLo + aLo * bHi) + aLo * bLo;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+| Double-precision operations rounded to nearest, which also store in `dir'
+| the sign of the exact result minus the returned one.
+*----------------------------------------------------------------------------*/
+
+static inline double host_double_add(double a, double b, int *dir)
+{
+    double s = a + b;
+    double bVirtual = s - a;
+    *dir = host_float_sign((a - (s - bVirtual)) + (b - bVirtual));
+    return s;
+}
+
+static inline double host_double_mul(double a, double b, int *dir)
+{
+    double p = a * b;
+    *dir = host_float_sign(host_float_product_error(a, b, p));
+    return p;
+}
+
+static inline double host_double_div(double a, double b, int *dir)
+{
+    double q = a / b;
+    double p = q * b;
+    // a - p is exact, and the remainder keeps its sign when rounded
+    *dir = host_float_sign((a - p) - host_float_product_error(q, b, p)) * host_float_sign(b);
+    return q;
+}
+
+static inline double host_double_sqrt(double a, int *dir)
+{
+    double s = sqrt(a);
+    double p = s * s;
+    *dir = host_float_sign((a - p) - host_float_product_error(s, s, p));
+    return s;
+}
+
+/*----------------------------------------------------------------------------
+| Rounds the double-precision value `d' to `rp' bits in rounding mode `rm',
+| `dir' being the sign of the exact result minus `d', and stores the result
+| in `z' after raising its flags in `status'.  Returns 0 if `d' is outside
+| the accepted range.
+|     `d' is the exact result rounded to nearest double precision.  For 32
+| the second rounding to nearest single precision is innocuous, as double
+| precision has more than twice as many bits, and it decides `dir' when it
+| is inexact.  The nearest value is then moved by one ulp if the rounding
+| mode rounds the exact result to its other neighbour.
+*----------------------------------------------------------------------------*/
+
+template <int rp, int rm>
+static inline int host_float_round(double d, int dir, floatx80 *z, float_status_t *status)
+{
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));
+    uint32_t exp = (uint32_t) (bits >> 52) & 0x7FF;
+    if (exp - host_float_range<rp>::min > host_float_range<rp>::max - host_float_range<rp>::min) return 0;
+
+    if (rp == 32) {
+        double f = (float) d;
+        if (f != d) dir = (f < d) ? 1 : -1;
+        memcpy(&bits, &f, sizeof(bits));
+        exp = (uint32_t) (bits >> 52) & 0x7FF;
+    }
+
+    int zSign = (int) (bits >> 63);
+    int32_t zExp = exp - 0x3FF + 0x3FFF;
+    uint64_t zSig = (bits << 11) | U64(0x8000000000000000);
+    if (dir) {
+        const uint64_t ulp = (uint64_t) 1 << ((rp == 32) ? 40 : 11);
+        int tooBig = zSign ? (dir > 0) : (dir < 0);
+        int away = (rm == float_round_nearest_even) ? tooBig
+                 : (rm == float_round_to_zero) ? 0
+                 : (rm == float_round_down) ? zSign : !zSign;
+        if (away && !tooBig) {
+            zSig += ulp;
+            if (zSig == 0) {
+                zSig = U64(0x8000000000000000);
+                zExp++;
+            }
+        } else if (!away && tooBig) {
+            if (zSig == U64(0x8000000000000000)) {
+                zSig = ~(ulp - 1);
+                zExp--;
+            } else {
+                zSig -= ulp;
+            }
+        }
+        float_raise(status, float_flag_inexact);
+        if (away) set_float_rounding_up(status);
+    }
+    *z = packFloatx80(zSign, zExp, zSig);
+    return 1;
+}
+
+/*----------------------------------------------------------------------------
+| Computes the operation `op' (0 add, 1 multiply, 4 subtract, 5 reversed
+| subtract, 6 divide, 7 reversed divide, numbered like the reg field of the
+| x87 instructions, or 8 square root of `a') on accepted operands and
+| stores the result in `z'.  Returns 0 if the result is outside the
+| accepted range.
+*----------------------------------------------------------------------------*/
+
+template <int rp, int rm, int op>
+static inline int host_float_operation(double a, double b, floatx80 *z, float_status_t *status)
+{
+    int dir;
+    double d;
+    switch (op) {
+        case 0:  d = host_double_add(a, b, &dir); break;
+        case 1:  d = host_double_mul(a, b, &dir); break;
+        case 4:  d = host_double_add(a, -b, &dir); break;
+        case 5:  d = host_double_add(b, -a, &dir); break;
+        case 6:  d = host_double_div(a, b, &dir); break;
+        case 7:  d = host_double_div(b, a, &dir); break;
+        default: d = host_double_sqrt(a, &dir); break;
+    }
+    return host_float_round<rp, rm>(d, dir, z, status);
+}
+
+template <int rp, int rm, int op>
+static floatx80 host_float_binary(floatx80 a, floatx80 b, float_status_t *status)
+{
+    double x, y;
+    floatx80 z;
+    if (host_float_from_floatx80<rp>(a, &x) && host_float_from_floatx80<rp>(b, &y)
+        && !floatx80_range_trap_pending(status) && host_float_operation<rp, rm, op>(x, y, &z, status)) {
+        host_float_counters.hits++;
+        return z;
+    }
+    host_float_counters.misses++;
+    const floatx80_rounding_ops *ops = floatx80_get_rounding_ops(rp, rm);
+    switch (op) {
+        case 0:  return ops->add(a, b, status);
+        case 1:  return ops->mul(a, b, status);
+        case 4:  return ops->sub(a, b, status);
+        default: return ops->div(a, b, status);
+    }
+}
+
+template <int rp, int rm>
+static floatx80 host_float_sqrt(floatx80 a, float_status_t *status)
+{
+    double x;
+    floatx80 z;
+    if (host_float_from_floatx80<rp>(a, &x) && !(a.exp & 0x8000)
+        && !floatx80_range_trap_pending(status) && host_float_operation<rp, rm, 8>(x, 0, &z, status)) {
+        host_float_counters.hits++;
+        return z;
+    }
+    host_float_counters.misses++;
+    return floatx80_get_rounding_ops(rp, rm)->sqrt(a, status);
+}
+
+/*----------------------------------------------------------------------------
+| Memory operand formats, see `floatx80_memory_ops'.  `value' stores in `x'
+| the double-precision value of `b' and returns 1 if it is an operand the
+| host path accepts.
+*----------------------------------------------------------------------------*/
+
+struct host_float_float32_operand {
+    typedef float32 type;
+
+    template <int rp>
+    static int value(float32 b, double *x) {
+        float f;
+        memcpy(&f, &b, sizeof(f));
+        *x = f;
+        return (uint32_t) extractFloat32Exp(b) - 1 < 0xFE && host_float_operand<rp>(*x);
+    }
+
+    static floatx80_result fallback(const floatx80_memory_ops *ops, int op, floatx80 a, float32 b, float_config_t config) {
+        return ops->float32_op[op](a, b, config);
+    }
+};
+
+struct host_float_int32_operand {
+    typedef int32_t type;
+
+    template <int rp>
+    static int value(int32_t b, double *x) {
+        *x = b;
+        return host_float_operand<rp>(*x);
+    }
+
+    static floatx80_result fallback(const floatx80_memory_ops *ops, int op, floatx80 a, int32_t b, float_config_t config) {
+        return ops->int32_op[op](a, b, config);
+    }
+};
+
+struct host_float_float64_operand {
+    typedef float64 type;
+
+    template <int rp>
+    static int value(float64 b, double *x) {
+        memcpy(x, &b, sizeof(*x));
+        return host_float_operand<rp>(*x);
+    }
+
+    static floatx80_result fallback(const floatx80_memory_ops *ops, int op, floatx80 a, float64 b, float_config_t config) {
+        return ops->float64_op[op](a, b, config);
+    }
+};
+
+template <int rp, int rm, typename F, int op>
+static floatx80_result host_float_memory(floatx80 a, typename F::type b, float_config_t config)
+{
+    double x, y;
+    if (host_float_from_floatx80<rp>(a, &x) && F::template value<rp>(b, &y)) {
+        float_status_t status = {};
+        float_config_to_status(config, &status);
+        floatx80 z;
+        if (host_float_operation<rp, rm, op>(x, y, &z, &status)) {
+            host_float_counters.hits++;
+            return floatx80_make_result(z, &status);
+        }
+    }
+    host_float_counters.misses++;
+    return F::fallback(floatx80_get_memory_ops(rp, rm), op, a, b, config);
+}
+
+#define HOST_FLOAT_ROUNDING_OPS(rp, rm) \
+    { host_float_binary<rp, rm, 0>, host_float_binary<rp, rm, 4>, host_float_binary<rp, rm, 1>, \
+      host_float_binary<rp, rm, 6>, host_float_sqrt<rp, rm>, \
+      floatx80_binary_result<host_float_binary<rp, rm, 0> >, floatx80_binary_result<host_float_binary<rp, rm, 4> >, \
+      floatx80_binary_result<host_float_binary<rp, rm, 1> >, floatx80_binary_result<host_float_binary<rp, rm, 6> >, \
+      floatx80_unary_result<host_float_sqrt<rp, rm> > }
+
+#define HOST_FLOAT_ROUNDING_OPS_PRECISION(rp) { \
+    HOST_FLOAT_ROUNDING_OPS(rp, float_round_nearest_even), \
+    HOST_FLOAT_ROUNDING_OPS(rp, float_round_down), \
+    HOST_FLOAT_ROUNDING_OPS(rp, float_round_up), \
+    HOST_FLOAT_ROUNDING_OPS(rp, float_round_to_zero) }
+
+static const floatx80_rounding_ops host_float_rounding_ops_table[2][4] = {
+    HOST_FLOAT_ROUNDING_OPS_PRECISION(32),
+    HOST_FLOAT_ROUNDING_OPS_PRECISION(64)
+};
+
+#undef HOST_FLOAT_ROUNDING_OPS_PRECISION
+#undef HOST_FLOAT_ROUNDING_OPS
+
+#define HOST_FLOAT_MEMORY_OPS_FORMAT(rp, rm, F) \
+    { host_float_memory<rp, rm, F, 0>, host_float_memory<rp, rm, F, 1>, 0, 0, \
+      host_float_memory<rp, rm, F, 4>, host_float_memory<rp, rm, F, 5>, \
+      host_float_memory<rp, rm, F, 6>, host_float_memory<rp, rm, F, 7> }
+
+#define HOST_FLOAT_MEMORY_OPS(rp, rm) { \
+    HOST_FLOAT_MEMORY_OPS_FORMAT(rp, rm, host_float_float32_operand), \
+    HOST_FLOAT_MEMORY_OPS_FORMAT(rp, rm, host_float_int32_operand), \
+    HOST_FLOAT_MEMORY_OPS_FORMAT(rp, rm, host_float_float64_operand) }
+
+#define HOST_FLOAT_MEMORY_OPS_PRECISION(rp) { \
+    HOST_FLOAT_MEMORY_OPS(rp, float_round_nearest_even), \
+    HOST_FLOAT_MEMORY_OPS(rp, float_round_down), \
+    HOST_FLOAT_MEMORY_OPS(rp, float_round_up), \
+    HOST_FLOAT_MEMORY_OPS(rp, float_round_to_zero) }
+
+static const floatx80_memory_ops host_float_memory_ops_table[2][4] = {
+    HOST_FLOAT_MEMORY_OPS_PRECISION(32),
+    HOST_FLOAT_MEMORY_OPS_PRECISION(64)
+};
+
+#undef HOST_FLOAT_MEMORY_OPS_PRECISION
+#undef HOST_FLOAT_MEMORY_OPS
+#undef HOST_FLOAT_MEMORY_OPS_FORMAT
+
+const floatx80_rounding_ops *floatx80_get_host_float_rounding_ops(int roundingPrecision, int roundingMode) {
+    if (roundingPrecision != 32 && roundingPrecision != 64)
+        return floatx80_get_rounding_ops(roundingPrecision, roundingMode);
+    return &host_float_rounding_ops_table[roundingPrecision == 64][roundingMode & 3];
+}
+
+const floatx80_memory_ops *floatx80_get_host_float_memory_ops(int roundingPrecision, int roundingMode) {
+    if (roundingPrecision != 32 && roundingPrecision != 64)
+        return floatx80_get_memory_ops(roundingPrecision, roundingMode);
+    return &host_float_memory_ops_table[roundingPrecision == 64][roundingMode & 3];
+}
+
+#else
+
+const floatx80_rounding_ops *floatx80_get_host_float_rounding_ops(int roundingPrecision, int roundingMode) {
+    return floatx80_get_rounding_ops(roundingPrecision, roundingMode);
+}
+
+const floatx80_memory_ops *floatx80_get_host_float_memory_ops(int roundingPrecision, int roundingMode) {
+    return floatx80_get_memory_ops(roundingPrecision, roundingMode);
+}
+
+#endif
+
+}
@@ -82,6 +82,7 @@ namespace libx87 {
 #include "libx87/softfloat/softfloat-specialize.h"
 
 #include "libx87/softfloat/fpu-constants.h"
+#include "libx87/softfloat/softfloat-poly.h"
 
 #include "libx87/softfloat/softfloatx80.h"
 
@@ -2574,10 +2575,10 @@ float64 float64_minmax(float64 a, float64 b, int is_max, int is_abs, float_statu
 floatx80 int32_to_floatx80(int32_t a) {
     if (a == 0) return packFloatx80(0, 0, 0);
     int zSign = (a < 0);
-    uint32_t absA = zSign ? -a : a;
-    int shiftCount = countLeadingZeros32(absA) + 32;
-    uint64_t zSig = absA;
-    return packFloatx80(zSign, 0x403E - shiftCount, zSig << shiftCount);
+    uint64_t signMask = -(uint64_t) zSign;
+    uint64_t absA = ((uint64_t) (int64_t) a ^ signMask) - signMask;
+    int shiftCount = countLeadingZeros64(absA);
+    return packFloatx80(zSign, 0x403E - shiftCount, absA << shiftCount);
 }
 
 /*----------------------------------------------------------------------------
@@ -2590,7 +2591,8 @@ floatx80 int32_to_floatx80(int32_t a) {
 floatx80 int64_to_floatx80(int64_t a) {
     if (a == 0) return packFloatx80(0, 0, 0);
     int zSign = (a < 0);
-    uint64_t absA = zSign ? -a : a;
+    uint64_t signMask = -(uint64_t) zSign;
+    uint64_t absA = ((uint64_t) a ^ signMask) - signMask;
     int shiftCount = countLeadingZeros64(absA);
     return packFloatx80(zSign, 0x403E - shiftCount, absA << shiftCount);
 }
@@ -2874,21 +2876,22 @@ floatx80 floatx80_round_to_int(floatx80 a, float_status_t *status) {
     int roundingMode = get_float_rounding_mode(status);
     floatx80 z;
 
-    // handle unsupported extended double-precision floating encodings
-    if (floatx80_is_unsupported(a)) {
-        float_raise(status, float_flag_invalid);
-        return floatx80_default_nan;
-    }
-
     int32_t aExp = extractFloatx80Exp(a);
     uint64_t aSig = extractFloatx80Frac(a);
-    if (0x403E <= aExp) {
-        if ((aExp == 0x7FFF) && (uint64_t) (aSig << 1)) {
-            return propagateFloatx80NaN(a, status);
+
+    // fast path: normal operands in [1, 2^63) go straight to masking the significand
+    if ((uint32_t) (aExp - 0x3FFF) >= 0x403E - 0x3FFF || (int64_t) aSig >= 0) {
+        // handle unsupported extended double-precision floating encodings
+        if (floatx80_is_unsupported(a)) {
+            float_raise(status, float_flag_invalid);
+            return floatx80_default_nan;
+        }
+        if (0x403E <= aExp) {
+            if ((aExp == 0x7FFF) && (uint64_t) (aSig << 1)) {
+                return propagateFloatx80NaN(a, status);
+            }
+            return a;
         }
-        return a;
-    }
-    if (aExp < 0x3FFF) {
         if (aExp == 0) {
             if ((aSig << 1) == 0) return a;
             float_raise(status, float_flag_denormal);
@@ -2922,6 +2925,7 @@ floatx80 floatx80_round_to_int(floatx80 a, float_status_t *status) {
     lastBitMask = 1;
     lastBitMask <<= 0x403E - aExp;
     roundBitsMask = lastBitMask - 1;
+    if ((aSig & roundBitsMask) == 0) return a;
     z = a;
     if (roundingMode == float_round_nearest_even) {
         z.fraction += lastBitMask >> 1;
@@ -2943,6 +2947,177 @@ floatx80 floatx80_round_to_int(floatx80 a, float_status_t *status) {
     return z;
 }
 
+/*----------------------------------------------------------------------------
+| Exponent range of the operands accepted by the extended double-precision
+| fast paths.  Operands in this range cannot produce a result that overflows
+| or underflows: a sum or difference of two of them is at most one binade
+| above the larger operand, and cancellation cannot remove more than 63 bits
+| below the smaller one.
+*----------------------------------------------------------------------------*/
+
+#define FLOATX80_FAST_EXP_MIN 0x0040
+#define FLOATX80_FAST_EXP_MAX 0x7FFC
+
+/*----------------------------------------------------------------------------
+| Rounding precision and rounding mode seen by the floatx80 arithmetic
+| specialised on `rp' and `rm':  the compile-time value, or the value held in
+| the status word when `rp' is 0 or `rm' is -1.
+*----------------------------------------------------------------------------*/
+
+template <int rp>
+BX_CPP_INLINE int floatx80RoundingPrecision(float_status_t *status)
+{
+    return rp ? rp : get_float_rounding_precision(status);
+}
+
+template <int rm>
+BX_CPP_INLINE int floatx80RoundingMode(float_status_t *status)
+{
+    return (rm < 0) ? get_float_rounding_mode(status) : rm;
+}
+
+/*----------------------------------------------------------------------------
+| Returns 1 if the extended double-precision floating-point value `a' is a
+| normalized finite number with its exponent in the fast path range.  Always
+| 0 when LIBX87_NO_FAST_PATH is defined, which the benchmarks use to time the
+| general add/subtract path on the same operands.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int floatx80_is_fast_operand(floatx80 a)
+{
+#ifdef LIBX87_NO_FAST_PATH
+    (void) a;
+    return 0;
+#else
+    return ((uint32_t) ((a.exp & 0x7FFF) - FLOATX80_FAST_EXP_MIN)
+                <= (FLOATX80_FAST_EXP_MAX - FLOATX80_FAST_EXP_MIN))
+        && (int64_t) a.fraction < 0;
+#endif
+}
+
+/*----------------------------------------------------------------------------
+| Rounds the abstract value formed by `zSign', `zExp', `zSig0' and `zSig1' to
+| the full 64-bit precision of the extended double-precision format.  This
+| is the 80-bit case of `roundAndPackFloatx80' for inputs that are known to
+| neither overflow nor underflow:  `zSig0' must be normalized and `zExp' must
+| lie in 1..0x7FFD.
+*----------------------------------------------------------------------------*/
+
+template <int rm>
+BX_CPP_INLINE floatx80 roundAndPackFloatx80Fast(int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1, float_status_t *status)
+{
+    int roundingMode = floatx80RoundingMode<rm>(status);
+    int increment;
+
+    if (roundingMode == float_round_nearest_even)
+        increment = ((int64_t) zSig1 < 0);
+    else if (roundingMode == float_round_to_zero)
+        increment = 0;
+    else
+        increment = (zSign ? (roundingMode == float_round_down) : (roundingMode == float_round_up)) && zSig1;
+
+    if (zSig1) float_raise(status, float_flag_inexact);
+    if (increment) {
+        zSig0++;
+        if (zSig0 == 0) {
+            zExp++;
+            zSig0 = U64(0x8000000000000000);
+            set_float_rounding_up(status);
+        } else if ((uint64_t) (zSig1 << 1) || roundingMode != float_round_nearest_even) {
+            set_float_rounding_up(status);
+        } else if (zSig0 & 1) {
+            // round half to even, the value below was the even one
+            zSig0 &= ~(uint64_t) 1;
+        } else {
+            set_float_rounding_up(status);
+        }
+    }
+    return packFloatx80(zSign, zExp, zSig0);
+}
+
+/*----------------------------------------------------------------------------
+| Fast path of `floatx80_add' and `floatx80_sub' for operands accepted by
+| `floatx80_is_fast_operand' when rounding to the full 64-bit precision.
+| Adds the absolute values of `a' and `b' if `subtract' is 0 or subtracts
+| them otherwise, negating the result if `zSign' is 1.  Produces exactly the
+| same result and flags as `addFloatx80Sigs'/`subFloatx80Sigs'.
+*----------------------------------------------------------------------------*/
+
+template <int rm>
+static floatx80 addSubFloatx80Fast(floatx80 a, floatx80 b, int zSign, int subtract, float_status_t *status)
+{
+    uint64_t aSig = extractFloatx80Frac(a);
+    int32_t aExp = extractFloatx80Exp(a);
+    uint64_t bSig = extractFloatx80Frac(b);
+    int32_t bExp = extractFloatx80Exp(b);
+    int32_t expDiff = aExp - bExp;
+    uint64_t zSig0, zSig1;
+    int32_t zExp;
+
+    if (expDiff < 0 || (expDiff == 0 && subtract && aSig < bSig)) {
+        uint64_t tSig = aSig; aSig = bSig; bSig = tSig;
+        aExp = bExp;
+        expDiff = -expDiff;
+        zSign ^= subtract;
+    }
+    zExp = aExp;
+    if (!subtract) {
+        shift64ExtraRightJamming(bSig, 0, expDiff, &bSig, &zSig1);
+        zSig0 = aSig + bSig;
+        if (zSig0 < aSig) {
+            shift64ExtraRightJamming(zSig0, zSig1, 1, &zSig0, &zSig1);
+            zSig0 |= U64(0x8000000000000000);
+            zExp++;
+        }
+    } else {
+        shift128RightJamming(bSig, 0, expDiff, &bSig, &zSig1);
+        sub128(aSig, 0, bSig, zSig1, &zSig0, &zSig1);
+        if (zSig0 == 0) {
+            if (zSig1 == 0)
+                return packFloatx80(floatx80RoundingMode<rm>(status) == float_round_down, 0, 0);
+            zSig0 = zSig1;
+            zSig1 = 0;
+            zExp -= 64;
+        }
+        int shiftCount = countLeadingZeros64(zSig0);
+        shortShift128Left(zSig0, zSig1, shiftCount, &zSig0, &zSig1);
+        zExp -= shiftCount;
+    }
+    return roundAndPackFloatx80Fast<rm>(zSign, zExp, zSig0, zSig1, status);
+}
+
+/*----------------------------------------------------------------------------
+| Returns 1 if the product of the extended double-precision floating-point
+| values `a' and `b', if both are normalized, can neither overflow nor
+| underflow, including the carry from rounding.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int floatx80_is_fast_product(floatx80 a, floatx80 b)
+{
+    return (uint32_t) (extractFloatx80Exp(a) + extractFloatx80Exp(b) - 0x4000) <= (0xBFFB - 0x4000);
+}
+
+/*----------------------------------------------------------------------------
+| Fast path of `floatx80_mul' for normalized operands accepted by
+| `floatx80_is_fast_product' when rounding to the full 64-bit precision.
+| Produces exactly the same result and flags as the general case.
+*----------------------------------------------------------------------------*/
+
+template <int rm>
+BX_CPP_INLINE floatx80 mulFloatx80Fast(floatx80 a, floatx80 b, float_status_t *status)
+{
+    int32_t zExp = extractFloatx80Exp(a) + extractFloatx80Exp(b) - 0x3FFE;
+    uint64_t zSig0, zSig1;
+
+    mul64To128(a.fraction, b.fraction, &zSig0, &zSig1);
+    if (0 < (int64_t) zSig0) {
+        shortShift128Left(zSig0, zSig1, 1, &zSig0, &zSig1);
+        --zExp;
+    }
+    return roundAndPackFloatx80Fast<rm>(extractFloatx80Sign(a) ^ extractFloatx80Sign(b),
+                                    zExp, zSig0, zSig1, status);
+}
+
 /*----------------------------------------------------------------------------
 | Returns the result of adding the absolute values of the extended double-
 | precision floating-point values `a' and `b'.  If `zSign' is 1, the sum is
@@ -2951,6 +3126,7 @@ floatx80 floatx80_round_to_int(floatx80 a, float_status_t *status) {
 | Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
+template <int rp, int rm>
 static floatx80 addFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_t *status) {
     int32_t aExp, bExp, zExp;
     uint64_t aSig, bSig, zSig0, zSig1;
@@ -2983,7 +3159,7 @@ static floatx80 addFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_
                 float_raise(status, float_flag_denormal);
                 normalizeFloatx80Subnormal(bSig, &bExp, &bSig);
             }
-            return roundAndPackFloatx80(get_float_rounding_precision(status),
+            return roundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                         zSign, bExp, bSig, 0, status);
         }
         float_raise(status, float_flag_denormal);
@@ -2991,7 +3167,7 @@ static floatx80 addFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_
     }
     if (bExp == 0) {
         if (bSig == 0)
-            return roundAndPackFloatx80(get_float_rounding_precision(status),
+            return roundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                         zSign, aExp, aSig, 0, status);
 
         float_raise(status, float_flag_denormal);
@@ -3017,7 +3193,7 @@ static floatx80 addFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_
     zExp++;
     roundAndPack:
     return
-            roundAndPackFloatx80(get_float_rounding_precision(status),
+            roundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                  zSign, zExp, zSig0, zSig1, status);
 }
 
@@ -3029,6 +3205,7 @@ static floatx80 addFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_
 | Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
+template <int rp, int rm>
 static floatx80 subFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_t *status) {
     int32_t aExp, bExp, zExp;
     uint64_t aSig, bSig, zSig0, zSig1;
@@ -3065,12 +3242,12 @@ static floatx80 subFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_
                 if (bSig) {
                     float_raise(status, float_flag_denormal);
                     normalizeFloatx80Subnormal(bSig, &bExp, &bSig);
-                    return roundAndPackFloatx80(get_float_rounding_precision(status),
+                    return roundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                                 zSign ^ 1, bExp, bSig, 0, status);
                 }
-                return packFloatx80(get_float_rounding_mode(status) == float_round_down, 0, 0);
+                return packFloatx80(floatx80RoundingMode<rm>(status) == float_round_down, 0, 0);
             }
-            return roundAndPackFloatx80(get_float_rounding_precision(status),
+            return roundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                         zSign ^ 1, bExp, bSig, 0, status);
         }
         float_raise(status, float_flag_denormal);
@@ -3078,7 +3255,7 @@ static floatx80 subFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_
     }
     if (bExp == 0) {
         if (bSig == 0)
-            return roundAndPackFloatx80(get_float_rounding_precision(status),
+            return roundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                         zSign, aExp, aSig, 0, status);
 
         float_raise(status, float_flag_denormal);
@@ -3096,7 +3273,7 @@ static floatx80 subFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_
     zSig1 = 0;
     if (bSig < aSig) goto aBigger;
     if (aSig < bSig) goto bBigger;
-    return packFloatx80(get_float_rounding_mode(status) == float_round_down, 0, 0);
+    return packFloatx80(floatx80RoundingMode<rm>(status) == float_round_down, 0, 0);
     bBigger:
     sub128(bSig, 0, aSig, zSig1, &zSig0, &zSig1);
     zExp = bExp;
@@ -3107,24 +3284,32 @@ static floatx80 subFloatx80Sigs(floatx80 a, floatx80 b, int zSign, float_status_
     zExp = aExp;
     normalizeRoundAndPack:
     return
-            normalizeRoundAndPackFloatx80(get_float_rounding_precision(status),
+            normalizeRoundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                           zSign, zExp, zSig0, zSig1, status);
 }
 
 /*----------------------------------------------------------------------------
 | Returns the result of adding the extended double-precision floating-point
 | values `a' and `b'.  The operation is performed according to the IEC/IEEE
-| Standard for Binary Floating-Point Arithmetic.
+| Standard for Binary Floating-Point Arithmetic.  The result is rounded to the
+| precision `rp' in the rounding mode `rm' (see `floatx80RoundingPrecision'
+| and `floatx80RoundingMode'); the same holds for the subtraction,
+| multiplication and division below.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_add(floatx80 a, floatx80 b, float_status_t *status) {
+template <int rp, int rm>
+static floatx80 floatx80_add_rc(floatx80 a, floatx80 b, float_status_t *status) {
     int aSign = extractFloatx80Sign(a);
     int bSign = extractFloatx80Sign(b);
 
+    if (floatx80_is_fast_operand(a) && floatx80_is_fast_operand(b)
+        && floatx80RoundingPrecision<rp>(status) == 80 && !floatx80_range_trap_pending(status))
+        return addSubFloatx80Fast<rm>(a, b, aSign, aSign != bSign, status);
+
     if (aSign == bSign)
-        return addFloatx80Sigs(a, b, aSign, status);
+        return addFloatx80Sigs<rp, rm>(a, b, aSign, status);
     else
-        return subFloatx80Sigs(a, b, aSign, status);
+        return subFloatx80Sigs<rp, rm>(a, b, aSign, status);
 }
 
 /*----------------------------------------------------------------------------
@@ -3133,14 +3318,19 @@ floatx80 floatx80_add(floatx80 a, floatx80 b, float_status_t *status) {
 | IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_sub(floatx80 a, floatx80 b, float_status_t *status) {
+template <int rp, int rm>
+static floatx80 floatx80_sub_rc(floatx80 a, floatx80 b, float_status_t *status) {
     int aSign = extractFloatx80Sign(a);
     int bSign = extractFloatx80Sign(b);
 
+    if (floatx80_is_fast_operand(a) && floatx80_is_fast_operand(b)
+        && floatx80RoundingPrecision<rp>(status) == 80 && !floatx80_range_trap_pending(status))
+        return addSubFloatx80Fast<rm>(a, b, aSign, aSign == bSign, status);
+
     if (aSign == bSign)
-        return subFloatx80Sigs(a, b, aSign, status);
+        return subFloatx80Sigs<rp, rm>(a, b, aSign, status);
     else
-        return addFloatx80Sigs(a, b, aSign, status);
+        return addFloatx80Sigs<rp, rm>(a, b, aSign, status);
 }
 
 /*----------------------------------------------------------------------------
@@ -3149,11 +3339,21 @@ floatx80 floatx80_sub(floatx80 a, floatx80 b, float_status_t *status) {
 | IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_mul(floatx80 a, floatx80 b, float_status_t *status) {
+template <int rp, int rm>
+static floatx80 floatx80_mul_rc(floatx80 a, floatx80 b, float_status_t *status) {
     int aSign, bSign, zSign;
     int32_t aExp, bExp, zExp;
     uint64_t aSig, bSig, zSig0, zSig1;
 
+    // fast path: normal operands whose product can neither overflow nor underflow
+    aExp = extractFloatx80Exp(a);
+    bExp = extractFloatx80Exp(b);
+    if (floatx80_is_fast_product(a, b)
+        && (int64_t) (a.fraction & b.fraction) < 0
+        && (uint32_t) (aExp - 1) < 0x7FFE && (uint32_t) (bExp - 1) < 0x7FFE
+        && floatx80RoundingPrecision<rp>(status) == 80 && !floatx80_range_trap_pending(status))
+        return mulFloatx80Fast<rm>(a, b, status);
+
     // handle unsupported extended double-precision floating encodings
     if (floatx80_is_unsupported(a) || floatx80_is_unsupported(b)) {
         invalid:
@@ -3207,7 +3407,7 @@ floatx80 floatx80_mul(floatx80 a, floatx80 b, float_status_t *status) {
         --zExp;
     }
     return
-            roundAndPackFloatx80(get_float_rounding_precision(status),
+            roundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                  zSign, zExp, zSig0, zSig1, status);
 }
 
@@ -3217,11 +3417,11 @@ floatx80 floatx80_mul(floatx80 a, floatx80 b, float_status_t *status) {
 | according to the IEC/IEEE Standard for Binary Floating-Point Arithmetic.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_div(floatx80 a, floatx80 b, float_status_t *status) {
+template <int rp, int rm>
+static floatx80 floatx80_div_rc(floatx80 a, floatx80 b, float_status_t *status) {
     int aSign, bSign, zSign;
     int32_t aExp, bExp, zExp;
-    uint64_t aSig, bSig, zSig0, zSig1;
-    uint64_t rem0, rem1, rem2, term0, term1, term2;
+    uint64_t aSig, bSig, zSig0, zSig1, rem1;
 
     // handle unsupported extended double-precision floating encodings
     if (floatx80_is_unsupported(a) || floatx80_is_unsupported(b)) {
@@ -3275,6 +3475,19 @@ floatx80 floatx80_div(floatx80 a, floatx80 b, float_status_t *status) {
         shift128Right(aSig, 0, 1, &aSig, &rem1);
         ++zExp;
     }
+#if defined(LIBX87_DIV_NEWTON)
+    // one reciprocal serves both quotient words, each corrected exactly
+    uint64_t bRecip = reciprocal64(bSig);
+    zSig0 = div128By64To64Reciprocal(aSig, rem1, bSig, bRecip, &rem1);
+    zSig1 = div128By64To64Reciprocal(rem1, 0, bSig, bRecip, &rem1);
+    zSig1 |= (rem1 != 0);
+#elif defined(LIBX87_HW_DIVIDE)
+    // aSig < bSig here, so both quotient words fit and need no correction
+    zSig0 = div128By64To64(aSig, rem1, bSig, &rem1);
+    zSig1 = div128By64To64(rem1, 0, bSig, &rem1);
+    zSig1 |= (rem1 != 0);
+#else
+    uint64_t rem0, rem2, term0, term1, term2;
     zSig0 = estimateDiv128To64(aSig, rem1, bSig);
     mul64To128(bSig, zSig0, &term0, &term1);
     sub128(aSig, rem1, term0, term1, &rem0, &rem1);
@@ -3292,22 +3505,25 @@ floatx80 floatx80_div(floatx80 a, floatx80 b, float_status_t *status) {
         }
         zSig1 |= ((rem1 | rem2) != 0);
     }
+#endif
     return
-            roundAndPackFloatx80(get_float_rounding_precision(status),
+            roundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                  zSign, zExp, zSig0, zSig1, status);
 }
 
 /*----------------------------------------------------------------------------
 | Returns the square root of the extended double-precision floating-point
 | value `a'.  The operation is performed according to the IEC/IEEE Standard
-| for Binary Floating-Point Arithmetic.
+| for Binary Floating-Point Arithmetic.  The result is rounded as in
+| `floatx80_add_rc'.
 *----------------------------------------------------------------------------*/
 
-floatx80 floatx80_sqrt(floatx80 a, float_status_t *status) {
+template <int rp, int rm>
+static floatx80 floatx80_sqrt_rc(floatx80 a, float_status_t *status) {
     int aSign;
     int32_t aExp, zExp;
     uint64_t aSig0, aSig1, zSig0, zSig1, doubleZSig0;
-    uint64_t rem0, rem1, rem2, rem3, term0, term1, term2, term3;
+    uint64_t rem1, rem2, rem3, term1, term2, term3;
 
     // handle unsupported extended double-precision floating encodings
     if (floatx80_is_unsupported(a)) {
@@ -3335,6 +3551,54 @@ floatx80 floatx80_sqrt(floatx80 a, float_status_t *status) {
         normalizeFloatx80Subnormal(aSig0, &aExp, &aSig0);
     }
     zExp = ((aExp - 0x3FFF) >> 1) + 0x3FFF;
+#ifdef LIBX87_NATIVE_INT128
+    shift128Right(aSig0, 0, 2 + (aExp & 1), &aSig0, &aSig1);
+    // y ~ 2^62/sqrt(t), where t = A/2^126 is the operand A = aSig0:aSig1 in [1/4, 1)
+    uint64_t aTop = (aSig0 << 2) | (aSig1 >> 62);
+    uint64_t y = estimateRsqrt64(aTop);
+    // sqrt(A) ~ t*y*2^63, improved by one Newton step on the remainder and then
+    // corrected to the exact integer square root
+    zSig0 = (uint64_t) (((uint128_native) aTop * y) >> 63);
+    int128_native r = (int128_native) (pack128(aSig0, aSig1) - (uint128_native) zSig0 * zSig0);
+    zSig0 += (int64_t) (((r >> 16) * y) >> 110);
+    r = (int128_native) (pack128(aSig0, aSig1) - (uint128_native) zSig0 * zSig0);
+    while (r < 0) {
+        --zSig0;
+        r += 2 * (int128_native) zSig0 + 1;
+    }
+    while (r > 2 * (int128_native) zSig0) {
+        r -= 2 * (int128_native) zSig0 + 1;
+        ++zSig0;
+    }
+    rem1 = (uint64_t) r;
+    doubleZSig0 = zSig0 << 1;
+    // next 64 root bits ~ rem*2^64/(2*zSig0) = rem*y/2^62, off by a few units at most;
+    // only estimates near a multiple of 2^62 can round differently from the exact bits
+    uint128_native q = ((uint128_native) rem1 * y) >> 62;
+    zSig1 = (q >> 64) ? U64(0xFFFFFFFFFFFFFFFF) : (uint64_t) q;
+    if (((zSig1 + 0x10000) & U64(0x3FFFFFFFFFFFFFFF)) <= 0x20000) {
+        mul64To128(doubleZSig0, zSig1, &term1, &term2);
+        sub128(rem1, 0, term1, term2, &rem1, &rem2);
+        mul64To128(zSig1, zSig1, &term2, &term3);
+        sub192(rem1, rem2, 0, 0, term2, term3, &rem1, &rem2, &rem3);
+        while ((int64_t) rem1 < 0) {
+            --zSig1;
+            shortShift128Left(0, zSig1, 1, &term2, &term3);
+            term3 |= 1;
+            term2 |= doubleZSig0;
+            add192(rem1, rem2, rem3, 0, term2, term3, &rem1, &rem2, &rem3);
+        }
+        for (;;) {
+            shortShift128Left(0, zSig1, 1, &term2, &term3);
+            term2 |= doubleZSig0;
+            if (rem1 == 0 && le128(rem2, rem3, term2, term3)) break;
+            sub192(rem1, rem2, rem3, 0, term2, term3 | 1, &rem1, &rem2, &rem3);
+            ++zSig1;
+        }
+        zSig1 |= ((rem1 | rem2 | rem3) != 0);
+    }
+#else
+    uint64_t rem0, term0;
     zSig0 = estimateSqrt32(aExp, aSig0 >> 32);
     shift128Right(aSig0, 0, 2 + (aExp & 1), &aSig0, &aSig1);
     zSig0 = estimateDiv128To64(aSig0, aSig1, zSig0 << 32) + (zSig0 << 30);
@@ -3362,13 +3626,236 @@ floatx80 floatx80_sqrt(floatx80 a, float_status_t *status) {
         }
         zSig1 |= ((rem1 | rem2 | rem3) != 0);
     }
+#endif
     shortShift128Left(0, zSig1, 1, &zSig0, &zSig1);
     zSig0 |= doubleZSig0;
     return
-            roundAndPackFloatx80(get_float_rounding_precision(status),
+            roundAndPackFloatx80<rp, rm>(floatx80RoundingPrecision<rp>(status),
                                  0, zExp, zSig0, zSig1, status);
 }
 
+/*----------------------------------------------------------------------------
+| Memory operand formats of the x87 arithmetic instructions.  `fast' stores
+| in `z' the extended double-precision value of `b' and returns 1 if `b' is
+| a normal number (a nonzero integer):  these convert exactly and without
+| raising any flag to an operand accepted by `floatx80_is_fast_operand'.
+| Otherwise it returns 0 and `convert' gives the value of `b'.
+*----------------------------------------------------------------------------*/
+
+struct floatx80_float32_operand {
+    typedef float32 type;
+
+    static int fast(float32 b, floatx80 *z) {
+        uint32_t bExp = extractFloat32Exp(b);
+        if (bExp - 1 >= 0xFE) return 0;
+        *z = packFloatx80(extractFloat32Sign(b), bExp + 0x3F80,
+                          (uint64_t) (extractFloat32Frac(b) | 0x00800000) << 40);
+        return 1;
+    }
+
+    static floatx80 convert(float32 b, float_status_t *status) {
+        return float32_to_floatx80(b, status);
+    }
+};
+
+struct floatx80_float64_operand {
+    typedef float64 type;
+
+    static int fast(float64 b, floatx80 *z) {
+        uint32_t bExp = extractFloat64Exp(b);
+        if (bExp - 1 >= 0x7FE) return 0;
+        *z = packFloatx80(extractFloat64Sign(b), bExp + 0x3C00,
+                          (extractFloat64Frac(b) | U64(0x0010000000000000)) << 11);
+        return 1;
+    }
+
+    static floatx80 convert(float64 b, float_status_t *status) {
+        return float64_to_floatx80(b, status);
+    }
+};
+
+struct floatx80_int32_operand {
+    typedef int32_t type;
+
+    static int fast(int32_t b, floatx80 *z) {
+        if (b == 0) return 0;
+        *z = int32_to_floatx80(b);
+        return 1;
+    }
+
+    static floatx80 convert(int32_t b, float_status_t *) {
+        return int32_to_floatx80(b);
+    }
+};
+
+/*----------------------------------------------------------------------------
+| Returns the result of the x87 arithmetic operation `op' (the reg field of
+| the instruction:  0 FADD, 1 FMUL, 4 FSUB, 5 FSUBR, 6 FDIV, 7 FDIVR) on the
+| extended double-precision value `a' and the memory operand `b' of format
+| `F'.  Produces exactly the same result and flags as converting `b' to the
+| extended double-precision format and passing it to `floatx80_add_rc' and
+| its siblings, but normal operands go straight to the fast paths without
+| being packed and classified again.
+*----------------------------------------------------------------------------*/
+
+template <int rp, int rm, typename F, int op>
+static floatx80 floatx80_memory_rc(floatx80 a, typename F::type b, float_status_t *status) {
+    floatx80 c;
+
+    if (F::fast(b, &c)) {
+        if (floatx80_is_fast_operand(a)
+            && floatx80RoundingPrecision<rp>(status) == 80 && !floatx80_range_trap_pending(status)) {
+            int aSign = extractFloatx80Sign(a);
+            int cSign = extractFloatx80Sign(c);
+            switch (op) {
+                case 0:
+                    return addSubFloatx80Fast<rm>(a, c, aSign, aSign != cSign, status);
+                case 1:
+                    if (floatx80_is_fast_product(a, c))
+                        return mulFloatx80Fast<rm>(a, c, status);
+                    break;
+                case 4:
+                    return addSubFloatx80Fast<rm>(a, c, aSign, aSign == cSign, status);
+                case 5:
+                    return addSubFloatx80Fast<rm>(c, a, cSign, aSign == cSign, status);
+            }
+        }
+    }
+    else c = F::convert(b, status);
+
+    switch (op) {
+        case 0:  return floatx80_add_rc<rp, rm>(a, c, status);
+        case 1:  return floatx80_mul_rc<rp, rm>(a, c, status);
+        case 4:  return floatx80_sub_rc<rp, rm>(a, c, status);
+        case 5:  return floatx80_sub_rc<rp, rm>(c, a, status);
+        case 6:  return floatx80_div_rc<rp, rm>(a, c, status);
+        default: return floatx80_div_rc<rp, rm>(c, a, status);
+    }
+}
+
+template <int rp, int rm, typename F, int op>
+static floatx80_result floatx80_memory_result(floatx80 a, typename F::type b, float_config_t config) {
+    float_status_t status = {};
+    float_config_to_status(config, &status);
+    floatx80 z = floatx80_memory_rc<rp, rm, F, op>(a, b, &status);
+    return floatx80_make_result(z, &status);
+}
+
+/*----------------------------------------------------------------------------
+| Generic entry points of the extended double-precision arithmetic, which take
+| the rounding precision and rounding mode from the status word.
+*----------------------------------------------------------------------------*/
+
+floatx80 floatx80_add(floatx80 a, floatx80 b, float_status_t *status) {
+    return floatx80_add_rc<0, -1>(a, b, status);
+}
+
+floatx80 floatx80_sub(floatx80 a, floatx80 b, float_status_t *status) {
+    return floatx80_sub_rc<0, -1>(a, b, status);
+}
+
+floatx80 floatx80_mul(floatx80 a, floatx80 b, float_status_t *status) {
+    return floatx80_mul_rc<0, -1>(a, b, status);
+}
+
+floatx80 floatx80_div(floatx80 a, floatx80 b, float_status_t *status) {
+    return floatx80_div_rc<0, -1>(a, b, status);
+}
+
+floatx80 floatx80_sqrt(floatx80 a, float_status_t *status) {
+    return floatx80_sqrt_rc<0, -1>(a, status);
+}
+
+floatx80_result floatx80_add_r(floatx80 a, floatx80 b, float_config_t config) {
+    return floatx80_binary_result<floatx80_add_rc<0, -1> >(a, b, config);
+}
+
+floatx80_result floatx80_sub_r(floatx80 a, floatx80 b, float_config_t config) {
+    return floatx80_binary_result<floatx80_sub_rc<0, -1> >(a, b, config);
+}
+
+floatx80_result floatx80_mul_r(floatx80 a, floatx80 b, float_config_t config) {
+    return floatx80_binary_result<floatx80_mul_rc<0, -1> >(a, b, config);
+}
+
+floatx80_result floatx80_div_r(floatx80 a, floatx80 b, float_config_t config) {
+    return floatx80_binary_result<floatx80_div_rc<0, -1> >(a, b, config);
+}
+
+floatx80_result floatx80_sqrt_r(floatx80 a, float_config_t config) {
+    return floatx80_unary_result<floatx80_sqrt_rc<0, -1> >(a, config);
+}
+
+/*----------------------------------------------------------------------------
+| Specialised entry points for each of the three rounding precisions and four
+| rounding modes, indexed by precision (32, 64, 80) and rounding mode.
+*----------------------------------------------------------------------------*/
+
+#define FLOATX80_ROUNDING_OPS(rp, rm) \
+    { floatx80_add_rc<rp, rm>, floatx80_sub_rc<rp, rm>, floatx80_mul_rc<rp, rm>, floatx80_div_rc<rp, rm>, \
+      floatx80_sqrt_rc<rp, rm>, \
+      floatx80_binary_result<floatx80_add_rc<rp, rm> >, floatx80_binary_result<floatx80_sub_rc<rp, rm> >, \
+      floatx80_binary_result<floatx80_mul_rc<rp, rm> >, floatx80_binary_result<floatx80_div_rc<rp, rm> >, \
+      floatx80_unary_result<floatx80_sqrt_rc<rp, rm> > }
+
+#define FLOATX80_ROUNDING_OPS_PRECISION(rp) { \
+    FLOATX80_ROUNDING_OPS(rp, float_round_nearest_even), \
+    FLOATX80_ROUNDING_OPS(rp, float_round_down), \
+    FLOATX80_ROUNDING_OPS(rp, float_round_up), \
+    FLOATX80_ROUNDING_OPS(rp, float_round_to_zero) }
+
+static const floatx80_rounding_ops floatx80_rounding_ops_table[3][4] = {
+    FLOATX80_ROUNDING_OPS_PRECISION(32),
+    FLOATX80_ROUNDING_OPS_PRECISION(64),
+    FLOATX80_ROUNDING_OPS_PRECISION(80)
+};
+
+#undef FLOATX80_ROUNDING_OPS_PRECISION
+#undef FLOATX80_ROUNDING_OPS
+
+#define FLOATX80_MEMORY_OPS_FORMAT(rp, rm, F) \
+    { floatx80_memory_result<rp, rm, F, 0>, floatx80_memory_result<rp, rm, F, 1>, 0, 0, \
+      floatx80_memory_result<rp, rm, F, 4>, floatx80_memory_result<rp, rm, F, 5>, \
+      floatx80_memory_result<rp, rm, F, 6>, floatx80_memory_result<rp, rm, F, 7> }
+
+#define FLOATX80_MEMORY_OPS(rp, rm) { \
+    FLOATX80_MEMORY_OPS_FORMAT(rp, rm, floatx80_float32_operand), \
+    FLOATX80_MEMORY_OPS_FORMAT(rp, rm, floatx80_int32_operand), \
+    FLOATX80_MEMORY_OPS_FORMAT(rp, rm, floatx80_float64_operand) }
+
+#define FLOATX80_MEMORY_OPS_PRECISION(rp) { \
+    FLOATX80_MEMORY_OPS(rp, float_round_nearest_even), \
+    FLOATX80_MEMORY_OPS(rp, float_round_down), \
+    FLOATX80_MEMORY_OPS(rp, float_round_up), \
+    FLOATX80_MEMORY_OPS(rp, float_round_to_zero) }
+
+static const floatx80_memory_ops floatx80_memory_ops_table[3][4] = {
+    FLOATX80_MEMORY_OPS_PRECISION(32),
+    FLOATX80_MEMORY_OPS_PRECISION(64),
+    FLOATX80_MEMORY_OPS_PRECISION(80)
+};
+
+#undef FLOATX80_MEMORY_OPS_PRECISION
+#undef FLOATX80_MEMORY_OPS
+#undef FLOATX80_MEMORY_OPS_FORMAT
+
+/*----------------------------------------------------------------------------
+| Returns the extended double-precision arithmetic specialised for rounding
+| to `roundingPrecision' bits (32, 64 or 80) in rounding mode `roundingMode'.
+| A precision other than 32 or 64 selects the full 80-bit precision, as in
+| `roundAndPackFloatx80'.  The same holds for the memory operand arithmetic.
+*----------------------------------------------------------------------------*/
+
+const floatx80_rounding_ops *floatx80_get_rounding_ops(int roundingPrecision, int roundingMode) {
+    int precisionIndex = (roundingPrecision == 32) ? 0 : (roundingPrecision == 64) ? 1 : 2;
+    return &floatx80_rounding_ops_table[precisionIndex][roundingMode & 3];
+}
+
+const floatx80_memory_ops *floatx80_get_memory_ops(int roundingPrecision, int roundingMode) {
+    int precisionIndex = (roundingPrecision == 32) ? 0 : (roundingPrecision == 64) ? 1 : 2;
+    return &floatx80_memory_ops_table[precisionIndex][roundingMode & 3];
+}
+
 #endif
 
 #ifdef FLOAT128
@@ -3944,6 +4431,12 @@ floatx80 floatx80_extract(floatx80 *input, float_status_t *status) {
     int32_t aExp = extractFloatx80Exp(a);
     int aSign = extractFloatx80Sign(a);
 
+    // fast path: normal operands already hold the significand, only the exponent is replaced
+    if ((uint32_t) (aExp - 1) < 0x7FFE && (int64_t) aSig < 0) {
+        input->exp = (aSign << 15) + 0x3FFF;
+        return int32_to_floatx80(aExp - 0x3FFF);
+    }
+
     if (floatx80_is_unsupported(a)) {
         float_raise(status, float_flag_invalid);
         a = floatx80_default_nan;
@@ -3989,12 +4482,6 @@ floatx80 floatx80_scale(floatx80 a, floatx80 b, float_status_t *status) {
     int32_t aExp, bExp;
     uint64_t aSig, bSig;
 
-    // handle unsupported extended double-precision floating encodings
-    if (floatx80_is_unsupported(a) || floatx80_is_unsupported(b)) {
-        float_raise(status, float_flag_invalid);
-        return floatx80_default_nan;
-    }
-
     aSig = extractFloatx80Frac(a);
     aExp = extractFloatx80Exp(a);
     int aSign = extractFloatx80Sign(a);
@@ -4002,6 +4489,21 @@ floatx80 floatx80_scale(floatx80 a, floatx80 b, float_status_t *status) {
     bExp = extractFloatx80Exp(b);
     int bSign = extractFloatx80Sign(b);
 
+    // fast path: normal `a' scaled by 1 <= |b| < 2^15 to a normal result, which is exact
+    if ((int64_t) (aSig & bSig) < 0 && (uint32_t) (aExp - 1) < 0x7FFE && (uint32_t) (bExp - 0x3FFF) < 15
+        && !floatx80_range_trap_pending(status)) {
+        int32_t scale = (int32_t) (bSig >> (0x403E - bExp));
+        int32_t zExp = aExp + (bSign ? -scale : scale);
+        if ((uint32_t) (zExp - 1) < 0x7FFE)
+            return packFloatx80(aSign, zExp, aSig);
+    }
+
+    // handle unsupported extended double-precision floating encodings
+    if (floatx80_is_unsupported(a) || floatx80_is_unsupported(b)) {
+        float_raise(status, float_flag_invalid);
+        return floatx80_default_nan;
+    }
+
     if (aExp == 0x7FFF) {
         if ((uint64_t) (aSig << 1) || ((bExp == 0x7FFF) && (uint64_t) (bSig << 1))) {
             return propagateFloatx80NaN_two_args(a, b, status);
@@ -4874,16 +5376,21 @@ void normalizeFloatx80Subnormal(uint64_t aSig, int32_t *zExpPtr, uint64_t *zSigP
 | returned is a subnormal number, and it must not require rounding.  The
 | handling of underflow and overflow follows the IEC/IEEE Standard for Binary
 | Floating-Point Arithmetic.
+|     A nonzero `rp' fixes the rounding precision and a nonnegative `rm' the
+| rounding mode at compile time; otherwise they are taken from
+| `roundingPrecision' and from the status word.
 *----------------------------------------------------------------------------*/
 
-floatx80 SoftFloatRoundAndPackFloatx80(int roundingPrecision,
+template <int rp, int rm>
+static floatx80 SoftFloatRoundAndPackFloatx80(int roundingPrecision,
                                        int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1,
                                        float_status_t *status) {
     uint64_t roundIncrement, roundMask, roundBits;
     int increment;
     uint64_t zSigExact; /* support rounding-up response */
 
-    uint8_t roundingMode = get_float_rounding_mode(status);
+    if (rp) roundingPrecision = rp;
+    uint8_t roundingMode = floatx80RoundingMode<rm>(status);
     int roundNearestEven = (roundingMode == float_round_nearest_even);
     if (roundingPrecision == 64) {
         roundIncrement = U64(0x0000000000000400);
@@ -5022,28 +5529,34 @@ floatx80 SoftFloatRoundAndPackFloatx80(int roundingPrecision,
     return packFloatx80(zSign, zExp, zSig0);
 }
 
+template <int rp, int rm>
 floatx80 roundAndPackFloatx80(int roundingPrecision,
                               int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1, float_status_t *status) {
     float_status_t round_status = *status;
-    floatx80 result = SoftFloatRoundAndPackFloatx80(roundingPrecision, zSign, zExp, zSig0, zSig1, status);
+    floatx80 result = SoftFloatRoundAndPackFloatx80<rp, rm>(roundingPrecision, zSign, zExp, zSig0, zSig1, status);
 
     // bias unmasked undeflow
     if (status->float_exception_flags & ~status->float_exception_masks & float_flag_underflow) {
         *status = round_status;
         float_raise(status, float_flag_underflow);
-        return SoftFloatRoundAndPackFloatx80(roundingPrecision, zSign, zExp + 0x6000, zSig0, zSig1, status);
+        return SoftFloatRoundAndPackFloatx80<rp, rm>(roundingPrecision, zSign, zExp + 0x6000, zSig0, zSig1, status);
     }
 
     // bias unmasked overflow
     if (status->float_exception_flags & ~status->float_exception_masks & float_flag_overflow) {
         *status = round_status;
         float_raise(status, float_flag_overflow);
-        return SoftFloatRoundAndPackFloatx80(roundingPrecision, zSign, zExp - 0x6000, zSig0, zSig1, status);
+        return SoftFloatRoundAndPackFloatx80<rp, rm>(roundingPrecision, zSign, zExp - 0x6000, zSig0, zSig1, status);
     }
 
     return result;
 }
 
+floatx80 roundAndPackFloatx80(int roundingPrecision,
+                              int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1, float_status_t *status) {
+    return roundAndPackFloatx80<0, -1>(roundingPrecision, zSign, zExp, zSig0, zSig1, status);
+}
+
 /*----------------------------------------------------------------------------
 | Takes an abstract floating-point value having sign `zSign', exponent
 | `zExp', and significand formed by the concatenation of `zSig0' and `zSig1',
@@ -5053,6 +5566,7 @@ floatx80 roundAndPackFloatx80(int roundingPrecision,
 | normalized.
 *----------------------------------------------------------------------------*/
 
+template <int rp, int rm>
 floatx80 normalizeRoundAndPackFloatx80(int roundingPrecision,
                                        int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1,
                                        float_status_t *status) {
@@ -5065,7 +5579,13 @@ floatx80 normalizeRoundAndPackFloatx80(int roundingPrecision,
     shortShift128Left(zSig0, zSig1, shiftCount, &zSig0, &zSig1);
     zExp -= shiftCount;
     return
-            roundAndPackFloatx80(roundingPrecision, zSign, zExp, zSig0, zSig1, status);
+            roundAndPackFloatx80<rp, rm>(roundingPrecision, zSign, zExp, zSig0, zSig1, status);
+}
+
+floatx80 normalizeRoundAndPackFloatx80(int roundingPrecision,
+                                       int zSign, int32_t zExp, uint64_t zSig0, uint64_t zSig1,
+                                       float_status_t *status) {
+    return normalizeRoundAndPackFloatx80<0, -1>(roundingPrecision, zSign, zExp, zSig0, zSig1, status);
 }
 
 #endif
@@ -5746,22 +6266,277 @@ these four paragraphs for those parts of this code that are retained.
 
 #define FLOAT128
 
-//                            2         3         4               n
-// f(x) ~ C + (C * x) + (C * x) + (C * x) + (C * x) + ... + (C * x)
-//         0    1         2         3         4               n
-//
-//          --       2k                --        2k+1
-//   p(x) = >  C  * x           q(x) = >  C   * x
-//          --  2k                     --  2k+1
-//
-//   f(x) ~ [ p(x) + x * q(x) ]
-//
+/*----------------------------------------------------------------------------
+| The table-driven transcendental kernels work in Q4.124 fixed point and need
+| native 128-bit integers.  Defining LIBX87_NO_TABLE_KERNELS leaves them out,
+| so that the instructions evaluate the float128 polynomials instead; the
+| benchmarks use it to time both on the same arithmetic.
+*----------------------------------------------------------------------------*/
 
-float128 EvalPoly(float128 x, float128 *arr, int n, float_status_t *status) {
-    float128 r = arr[--n];
+#if defined(LIBX87_NATIVE_INT128) && !defined(LIBX87_NO_TABLE_KERNELS)
+#define LIBX87_TABLE_KERNELS
+#endif
 
-    do {
-        r = float128_mul(r, x, status);
+#ifdef LIBX87_NATIVE_INT128
+
+/*----------------------------------------------------------------------------
+| Fixed-point polynomial evaluation.  The polynomials below are evaluated on
+| signed Q4.124 numbers held in native 128-bit integers instead of with the
+| packed float128 operations:  every step of the Estrin scheme is a
+| 128x128-bit multiply and an add, and the value is rounded to float128
+| once, at the end.  The truncation error is below 2^-120 absolute; as the
+| polynomial values are near 1, the result is within an ulp of the float128
+| evaluation.  All the callers raise inexact themselves, so only the value
+| is produced here.
+|   The evaluators fall back to float128 arithmetic for |x| >= 1, for |x|
+| below 2^-4096 (where the float128 chain underflows), for coefficients
+| outside (-2, 2) or adding up to 4 in magnitude and for results smaller
+| than 2^-8.
+*----------------------------------------------------------------------------*/
+
+#define FLOAT128_FIXED_FRAC_BITS 124
+
+/*----------------------------------------------------------------------------
+| Unpacked quadruple-precision value:  `sig' holds the 113-bit significand
+| with the integer bit at position 112 and `exp' the biased exponent.
+*----------------------------------------------------------------------------*/
+
+struct float128_unpacked {
+    int sign;
+    int32_t exp;
+    uint128_native sig;
+};
+
+BX_CPP_INLINE float128 packFloat128Unpacked(float128_unpacked z)
+{
+    return packFloat128(z.sign, z.exp - 1, (uint64_t) (z.sig>>64), (uint64_t) z.sig);
+}
+
+/*----------------------------------------------------------------------------
+| Rounds the significand `zSig' with the discarded bits `rem' (`half' being
+| the weight of the first discarded bit) to nearest-even, the only rounding
+| float128 arithmetic uses, and stores it into `z'.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE void roundFloat128Unpacked(float128_unpacked *z, uint128_native zSig, uint128_native rem, uint128_native half)
+{
+    if ((rem > half) || ((rem == half) && (zSig & 1))) zSig++;
+    if (zSig>>113) {
+        zSig >>= 1;
+        z->exp++;
+    }
+    z->sig = zSig;
+}
+
+/*----------------------------------------------------------------------------
+| Returns the 256-bit product of `a' and `b' shifted right by `count' bits
+| (1..127); the result must fit in 128 bits.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE uint128_native mul128To256ShiftRight(uint128_native a, uint128_native b, int count)
+{
+    uint64_t a0 = (uint64_t) a, a1 = (uint64_t) (a>>64);
+    uint64_t b0 = (uint64_t) b, b1 = (uint64_t) (b>>64);
+    uint128_native lo = (uint128_native) a0 * b0;
+    uint128_native mid1 = (uint128_native) a1 * b0;
+    uint128_native mid2 = (uint128_native) a0 * b1;
+    uint128_native t = (lo>>64) + (uint64_t) mid1 + (uint64_t) mid2;
+    uint128_native hi = (uint128_native) a1 * b1 + (mid1>>64) + (mid2>>64) + (t>>64);
+    lo = (t<<64) | (uint64_t) lo;
+    return (hi<<(128 - count)) | (lo>>count);
+}
+
+/*----------------------------------------------------------------------------
+| Converts the float128 value `a' with |a| < 2 to Q4.124, truncating toward
+| zero.  Returns 0 if `a' is out of range.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int float128ToFixed(float128 a, int128_native *z)
+{
+    int32_t aExp = extractFloat128Exp(a);
+    if (aExp >= 0x4000) return 0;
+    uint128_native aSig = pack128(extractFloat128Frac0(a) | U64(0x0001000000000000), extractFloat128Frac1(a));
+    int shiftCount = 0x3FFF + 112 - FLOAT128_FIXED_FRAC_BITS - aExp;
+    if (shiftCount >= 128 || aExp == 0) aSig = 0;
+    else if (shiftCount > 0) aSig >>= shiftCount;
+    else aSig <<= -shiftCount;
+    *z = extractFloat128Sign(a) ? -(int128_native) aSig : (int128_native) aSig;
+    return 1;
+}
+
+/*----------------------------------------------------------------------------
+| Unpacks the float128 value `a' if it is a normal number with 2^-32 <= |a| < 1
+| and stores its Q4.124 form into `z'.  Below 2^-32 the terms past the
+| constant one may fall under the Q4.124 resolution, and a result such as
+| cos(a) would round to exactly 1 and lose its inexact round-up; smaller
+| arguments are left to the float128 chain.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int unpackFloat128PolyArgument(float128 a, float128_unpacked *ua, int128_native *z)
+{
+    int32_t aExp = extractFloat128Exp(a);
+    if ((uint32_t) (aExp - (0x3FFF - 32)) >= 32) return 0;
+    ua->sign = extractFloat128Sign(a);
+    ua->exp = aExp;
+    ua->sig = pack128(extractFloat128Frac0(a) | U64(0x0001000000000000), extractFloat128Frac1(a));
+    return float128ToFixed(a, z);
+}
+
+/*----------------------------------------------------------------------------
+| Returns the Q4.124 product of `a' and `b', truncated toward zero.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int128_native mulFixed(int128_native a, int128_native b)
+{
+    int128_native sign = (a ^ b) >> 127;
+    uint128_native absA = (a < 0) ? -(uint128_native) a : (uint128_native) a;
+    uint128_native absB = (b < 0) ? -(uint128_native) b : (uint128_native) b;
+    int128_native z = (int128_native) mul128To256ShiftRight(absA, absB, FLOAT128_FIXED_FRAC_BITS);
+    return (z ^ sign) - sign;
+}
+
+/*----------------------------------------------------------------------------
+| Rounds the Q4.124 value `a' to quadruple precision.  Returns 0 if |a| is
+| below 2^-8, where too few significant bits are left.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int fixedToFloat128Unpacked(int128_native a, float128_unpacked *z)
+{
+    uint128_native absA = (a < 0) ? -(uint128_native) a : (uint128_native) a;
+    if ((absA>>(FLOAT128_FIXED_FRAC_BITS - 8)) == 0) return 0;
+    int shiftCount = countLeadingZeros64((uint64_t) (absA>>64));
+    absA <<= shiftCount;
+    z->sign = (a < 0);
+    z->exp = 0x3FFF + 127 - FLOAT128_FIXED_FRAC_BITS - shiftCount;
+    roundFloat128Unpacked(z, absA>>15, absA & 0x7FFF, 0x4000);
+    return 1;
+}
+
+/*----------------------------------------------------------------------------
+| Rounds the nonzero Q4.124 value `a' to quadruple precision without the
+| magnitude check of `fixedToFloat128Unpacked', for callers that know how
+| many of its bits are significant.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE void normalizeFixedToFloat128Unpacked(int128_native a, float128_unpacked *z)
+{
+    uint128_native absA = (a < 0) ? -(uint128_native) a : (uint128_native) a;
+    int shiftCount = (absA>>64) ? countLeadingZeros64((uint64_t) (absA>>64))
+                                : 64 + countLeadingZeros64((uint64_t) absA);
+    absA <<= shiftCount;
+    z->sign = (a < 0);
+    z->exp = 0x3FFF + 127 - FLOAT128_FIXED_FRAC_BITS - shiftCount;
+    roundFloat128Unpacked(z, absA>>15, absA & 0x7FFF, 0x4000);
+}
+
+/*----------------------------------------------------------------------------
+| Multiplies two unpacked values and rounds the product to nearest.  Bits
+| more than 15 places below the result are truncated before rounding.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE void mulFloat128Unpacked(float128_unpacked a, float128_unpacked b, float128_unpacked *z)
+{
+    uint128_native zSig = mul128To256ShiftRight(a.sig, b.sig, 98);
+    z->sign = a.sign ^ b.sign;
+    z->exp = a.exp + b.exp - 0x3FFF;
+    if (zSig>>127) z->exp++;
+    else zSig <<= 1;
+    roundFloat128Unpacked(z, zSig>>15, zSig & 0x7FFF, 0x4000);
+}
+
+/*----------------------------------------------------------------------------
+| Evaluates the polynomial with the `n' Q4.124 coefficients `c', lowest
+| order first, at the Q4.124 point `x' as p(x^2) + x * q(x^2), where p takes
+| the even and q the odd coefficients:  the first level of Estrin's scheme.
+| The two Horner chains in x^2 are independent, which halves the dependency
+| chain for one extra product.  Splitting further does not pay, as the
+| squarings cost more than the shorter chain saves on these 128-bit
+| products.  Every partial sum is bounded by the sum of the |c[i]|, which
+| the caller keeps in range.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int128_native EvalPolyFixedEstrin(int128_native x, const int128_native *c, int n)
+{
+    int128_native x2 = mulFixed(x, x);
+    int i = (n - 1) & ~1;
+    int128_native p = c[i];
+    while (i >= 2) {
+        i -= 2;
+        p = c[i] + mulFixed(p, x2);
+    }
+    if (n == 1) return p;
+    i = (n - 2) | 1;
+    int128_native q = c[i];
+    while (i >= 3) {
+        i -= 2;
+        q = c[i] + mulFixed(q, x2);
+    }
+    return p + mulFixed(q, x);
+}
+
+/*----------------------------------------------------------------------------
+| Evaluates the polynomial with the `n' Q4.124 coefficients `c', lowest
+| order first, at the Q4.124 point `x' by Horner's rule.  Used where two
+| polynomials are evaluated side by side, which already keeps two chains in
+| flight without the extra squaring of `EvalPolyFixedEstrin'.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE int128_native EvalPolyFixedHorner(int128_native x, const int128_native *c, int n)
+{
+    int128_native r = c[n - 1];
+    for (int i = n - 2; i >= 0; i--)
+        r = c[i] + mulFixed(r, x);
+    return r;
+}
+
+/*----------------------------------------------------------------------------
+| Evaluates the polynomial with the `n' float128 coefficients `arr' at the
+| Q4.124 point |x| < 1.  Returns 0 if the coefficients are not representable
+| or their magnitudes add up to 4 or more, which could take an intermediate
+| value out of the fixed-point range.
+*----------------------------------------------------------------------------*/
+
+static int EvalPolyFixed(int128_native x, const float128 *arr, int n, int128_native *r) {
+    int128_native c[EVAL_POLY_MAX_SIZE];
+    uint128_native sum = 0;
+    const uint128_native limit = (uint128_native) 4 << FLOAT128_FIXED_FRAC_BITS;
+
+    for (int i = 0; i < n; i++) {
+        if (!float128ToFixed(arr[i], &c[i])) return 0;
+        sum += (c[i] < 0) ? -(uint128_native) c[i] : (uint128_native) c[i];
+    }
+    if (sum >= limit) return 0;
+
+    *r = EvalPolyFixedEstrin(x, c, n);
+    return 1;
+}
+
+#endif
+
+//                            2         3         4               n
+// f(x) ~ C + (C * x) + (C * x) + (C * x) + (C * x) + ... + (C * x)
+//         0    1         2         3         4               n
+//
+//          --       2k                --        2k+1
+//   p(x) = >  C  * x           q(x) = >  C   * x
+//          --  2k                     --  2k+1
+//
+//   f(x) ~ [ p(x) + x * q(x) ]
+//
+
+float128 EvalPoly(float128 x, const float128 *arr, int n, float_status_t *status) {
+#ifdef LIBX87_NATIVE_INT128
+    float128_unpacked ux, ur;
+    int128_native fx, fr;
+    if (unpackFloat128PolyArgument(x, &ux, &fx) && EvalPolyFixed(fx, arr, n, &fr)
+        && fixedToFloat128Unpacked(fr, &ur))
+        return packFloat128Unpacked(ur);
+#endif
+
+    float128 r = arr[--n];
+
+    do {
+        r = float128_mul(r, x, status);
         r = float128_add(r, arr[--n], status);
     } while (n > 0);
 
@@ -5780,7 +6555,15 @@ float128 EvalPoly(float128 x, float128 *arr, int n, float_status_t *status) {
 //   f(x) ~ [ p(x) + x * q(x) ]
 //
 
-float128 EvenPoly(float128 x, float128 *arr, int n, float_status_t *status) {
+float128 EvenPoly(float128 x, const float128 *arr, int n, float_status_t *status) {
+#ifdef LIBX87_NATIVE_INT128
+    float128_unpacked ux, ur;
+    int128_native fx, fr;
+    if (unpackFloat128PolyArgument(x, &ux, &fx) && EvalPolyFixed(mulFixed(fx, fx), arr, n, &fr)
+        && fixedToFloat128Unpacked(fr, &ur))
+        return packFloat128Unpacked(ur);
+#endif
+
     return EvalPoly(float128_mul(x, x, status), arr, n, status);
 }
 
@@ -5799,7 +6582,17 @@ float128 EvenPoly(float128 x, float128 *arr, int n, float_status_t *status) {
 //   f(x) ~ x * [ p(x) + x * q(x) ]
 //
 
-float128 OddPoly(float128 x, float128 *arr, int n, float_status_t *status) {
+float128 OddPoly(float128 x, const float128 *arr, int n, float_status_t *status) {
+#ifdef LIBX87_NATIVE_INT128
+    float128_unpacked ux, ur;
+    int128_native fx, fr;
+    if (unpackFloat128PolyArgument(x, &ux, &fx) && EvalPolyFixed(mulFixed(fx, fx), arr, n, &fr)
+        && fixedToFloat128Unpacked(fr, &ur)) {
+        mulFloat128Unpacked(ux, ur, &ur);
+        return packFloat128Unpacked(ur);
+    }
+#endif
+
     return float128_mul(x, EvenPoly(x, arr, n, status), status);
 }
 
@@ -5843,22 +6636,11 @@ static const float128 float128_ln2inv2 =
 
 #define SQRT2_HALF_SIG    U64(0xb504f333f9de6484)
 
-extern float128 OddPoly(float128 x, float128 *arr, int n, float_status_t *status);
+extern float128 OddPoly(float128 x, const float128 *arr, int n, float_status_t *status);
+
+#ifndef LIBX87_TABLE_KERNELS
 
-#define L2_ARR_SIZE 9
 
-static float128 ln_arr[L2_ARR_SIZE] =
-        {
-                PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
-                PACK_FLOAT_128(0x3ffd555555555555, 0x5555555555555555), /*  3 */
-                PACK_FLOAT_128(0x3ffc999999999999, 0x999999999999999a), /*  5 */
-                PACK_FLOAT_128(0x3ffc249249249249, 0x2492492492492492), /*  7 */
-                PACK_FLOAT_128(0x3ffbc71c71c71c71, 0xc71c71c71c71c71c), /*  9 */
-                PACK_FLOAT_128(0x3ffb745d1745d174, 0x5d1745d1745d1746), /* 11 */
-                PACK_FLOAT_128(0x3ffb3b13b13b13b1, 0x3b13b13b13b13b14), /* 13 */
-                PACK_FLOAT_128(0x3ffb111111111111, 0x1111111111111111), /* 15 */
-                PACK_FLOAT_128(0x3ffae1e1e1e1e1e1, 0xe1e1e1e1e1e1e1e2)  /* 17 */
-        };
 
 static float128 poly_ln(float128 x1, float_status_t *status) {
 /*
@@ -5907,6 +6689,336 @@ static float128 poly_l2p1(float128 x, float_status_t *status) {
     return x;
 }
 
+#endif
+
+#ifdef LIBX87_TABLE_KERNELS
+
+/*----------------------------------------------------------------------------
+| Table-driven log2(m) for sqrt(2)/2 <= m < sqrt(2).  `m' is rounded to the
+| nearest breakpoint c = 1 + i/256 above 1 or c = 1 - i/512 below it, and
+| with r ~ 1/c a 25-bit reciprocal whose product with `m' is exact,
+|
+|     log2(m) = log2(1 + u) - log2(r),  u = m * r - 1,  |u| < 2^-8.99
+|
+| where log2(1 + u) = u * p(u) with a twelve-term polynomial p, whose
+| truncation error is below 2^-110.  The sum is formed in Q4.124 (see
+| `EvalPolyFixed'); for i = 0, r = 1 and the result is the floating-point
+| product u * p(u), so that arguments close to 1 keep their relative
+| precision.
+*----------------------------------------------------------------------------*/
+
+#define LOG2_RECIP_FRAC_BITS 24
+
+// {2^24 * r, -log2(r) in Q4.124} for c = 1 + i/256, i = 0..106
+static const uint64_t log2_table_up[107][3] =
+        {
+        {U64(0x01000000), U64(0x0000000000000000), U64(0x0000000000000000)}, /* 1 + 0/256 */
+        {U64(0x00ff00ff), U64(0x001709c4848ff3dc), U64(0x81e75eeea83c850b)}, /* 1 + 1/256 */
+        {U64(0x00fe03f8), U64(0x002dfca2df328701), U64(0x41f003e85da91e93)}, /* 1 + 2/256 */
+        {U64(0x00fd08e5), U64(0x0044d8cbac61845b), U64(0xbf707174532103f4)}, /* 1 + 3/256 */
+        {U64(0x00fc0fc1), U64(0x005b9e59bab62b12), U64(0x3456e251d6677f7b)}, /* 1 + 4/256 */
+        {U64(0x00fb1885), U64(0x00724d9833a3f9ac), U64(0x67d89b68d3eed402)}, /* 1 + 5/256 */
+        {U64(0x00fa232d), U64(0x0088e68d656fb917), U64(0xe105974775f518e5)}, /* 1 + 6/256 */
+        {U64(0x00f92fb2), U64(0x009f6987b4164cd4), U64(0xe6ab51a97775e032)}, /* 1 + 7/256 */
+        {U64(0x00f83e10), U64(0x00b5d69021d43c86), U64(0x711cdb00de7b8f3a)}, /* 1 + 8/256 */
+        {U64(0x00f74e40), U64(0x00cc2df854f8b410), U64(0xce82a25f95aad5fb)}, /* 1 + 9/256 */
+        {U64(0x00f6603e), U64(0x00e26fcc0b5b3e57), U64(0x29467649cf59abaa)}, /* 1 + 10/256 */
+        {U64(0x00f57404), U64(0x00f89c4821ea57f0), U64(0xdc5a76615e8f60e6)}, /* 1 + 11/256 */
+        {U64(0x00f4898d), U64(0x010eb392fe79def3), U64(0x13bd723863585123)}, /* 1 + 12/256 */
+        {U64(0x00f3a0d5), U64(0x0124b5bc1e1dbfbf), U64(0x2e882dcf1e618621)}, /* 1 + 13/256 */
+        {U64(0x00f2b9d6), U64(0x013aa304acd04f3a), U64(0xd33e20f611d30702)}, /* 1 + 14/256 */
+        {U64(0x00f1d48c), U64(0x01507b7eafe13b5a), U64(0x60f298bded0fcbc5)}, /* 1 + 15/256 */
+        {U64(0x00f0f0f1), U64(0x01663f6e3b3cbb20), U64(0x9f3908c93c8d18a5)}, /* 1 + 16/256 */
+        {U64(0x00f00f01), U64(0x017beee7e3206a68), U64(0xe7eacf9bc459b1b5)}, /* 1 + 17/256 */
+        {U64(0x00ef2eb7), U64(0x01918a19f536b14e), U64(0xcc941abc5666d2bb)}, /* 1 + 18/256 */
+        {U64(0x00ee500f), U64(0x01a7111b55df32ee), U64(0xb0e27c0c181742ba)}, /* 1 + 19/256 */
+        {U64(0x00ed7304), U64(0x01bc841cd4346d29), U64(0x2c39279c067bd22a)}, /* 1 + 20/256 */
+        {U64(0x00ec9791), U64(0x01d1e350a4f6b571), U64(0x45508587ec2713c4)}, /* 1 + 21/256 */
+        {U64(0x00ebbdb3), U64(0x01e72eb841d50818), U64(0x20dae1db790a3973)}, /* 1 + 22/256 */
+        {U64(0x00eae564), U64(0x01fc66a14d0527de), U64(0x6b8979c2785a74ed)}, /* 1 + 23/256 */
+        {U64(0x00ea0ea1), U64(0x02118b0f71508b10), U64(0xa8a00bf84d6b2f75)}, /* 1 + 24/256 */
+        {U64(0x00e93965), U64(0x02269c39b90988cc), U64(0x140695ce9726e2be)}, /* 1 + 25/256 */
+        {U64(0x00e865ac), U64(0x023b9a3f2df3606c), U64(0xd2d5d09f74e28d13)}, /* 1 + 26/256 */
+        {U64(0x00e79373), U64(0x0250852667369418), U64(0x2bb0eb04fdbe998a)}, /* 1 + 27/256 */
+        {U64(0x00e6c2b4), U64(0x02655d4385bc1402), U64(0x0d2a6c20caf1c654)}, /* 1 + 28/256 */
+        {U64(0x00e5f36d), U64(0x027a2285aceb7bb6), U64(0xfd8f41b3be173204)}, /* 1 + 29/256 */
+        {U64(0x00e52598), U64(0x028ed543847c4d06), U64(0x2f6e20d2c4bfa0e4)}, /* 1 + 30/256 */
+        {U64(0x00e45933), U64(0x02a3756e008e04db), U64(0xbba33ddb290f7a19)}, /* 1 + 31/256 */
+        {U64(0x00e38e39), U64(0x02b803445cd1e47c), U64(0xae3065d06b727e7d)}, /* 1 + 32/256 */
+        {U64(0x00e2c4a7), U64(0x02cc7ed32ce9bfab), U64(0x50652dc5e9b838d4)}, /* 1 + 33/256 */
+        {U64(0x00e1fc78), U64(0x02e0e85c0f34c643), U64(0x7ad733e34a85ed4f)}, /* 1 + 34/256 */
+        {U64(0x00e135aa), U64(0x02f53fd362e4720a), U64(0xf3d2140431aeafee)}, /* 1 + 35/256 */
+        {U64(0x00e07038), U64(0x0309857ce8896333), U64(0x553322fbcdcd38a9)}, /* 1 + 36/256 */
+        {U64(0x00dfac1f), U64(0x031db96904b38823), U64(0xd3607868ce4365b2)}, /* 1 + 37/256 */
+        {U64(0x00dee95c), U64(0x0331dba8df1ea804), U64(0x763953dadc372740)}, /* 1 + 38/256 */
+        {U64(0x00de27eb), U64(0x0345ec68fd5446f6), U64(0x35c284981335ba9a)}, /* 1 + 39/256 */
+        {U64(0x00dd67c9), U64(0x0359ebbc55f8934b), U64(0xf070551571af4406)}, /* 1 + 40/256 */
+        {U64(0x00dca8f1), U64(0x036dd9ec358278c0), U64(0x4bd031526d4965d9)}, /* 1 + 41/256 */
+        {U64(0x00dbeb62), U64(0x0381b6d7ed8029f2), U64(0xbeb19f576903734a)}, /* 1 + 42/256 */
+        {U64(0x00db2f17), U64(0x039582cab6ca7c1f), U64(0x05eb5ee2c887ad80)}, /* 1 + 43/256 */
+        {U64(0x00da740e), U64(0x03a93dc025a62ec7), U64(0x12e3283db5e925f3)}, /* 1 + 44/256 */
+        {U64(0x00d9ba42), U64(0x03bce805a8a37600), U64(0x9c5ece395fc72e14)}, /* 1 + 45/256 */
+        {U64(0x00d901b2), U64(0x03d0817d4622672e), U64(0x5ff4ae2ce5c4fe6c)}, /* 1 + 46/256 */
+        {U64(0x00d84a5a), U64(0x03e40a5b0eee891d), U64(0xb0550c2f3b9e947b)}, /* 1 + 47/256 */
+        {U64(0x00d79436), U64(0x03f782d43da414cd), U64(0x2f4a36a41b3eef81)}, /* 1 + 48/256 */
+        {U64(0x00d6df44), U64(0x040aeae836ec7b5a), U64(0xd0869df3855bada3)}, /* 1 + 49/256 */
+        {U64(0x00d62b81), U64(0x041e42b269e41109), U64(0xf71787235f32229d)}, /* 1 + 50/256 */
+        {U64(0x00d578e9), U64(0x04318a6ac46d3574), U64(0x7c359b6c359cf64b)}, /* 1 + 51/256 */
+        {U64(0x00d4c77b), U64(0x0444c1f71117fb08), U64(0x29124a277e6035de)}, /* 1 + 52/256 */
+        {U64(0x00d41733), U64(0x0457e990c9df61ec), U64(0xfebec70d0a2f525a)}, /* 1 + 53/256 */
+        {U64(0x00d3680d), U64(0x046b017297f884ee), U64(0x3debf041fd250124)}, /* 1 + 54/256 */
+        {U64(0x00d2ba08), U64(0x047e0984341f9a28), U64(0xee64b7c29a1cb5f3)}, /* 1 + 55/256 */
+        {U64(0x00d20d21), U64(0x049101e5b6da30cc), U64(0x6f1bf4d30885a117)}, /* 1 + 56/256 */
+        {U64(0x00d16154), U64(0x04a3ead4471ad3e6), U64(0x13d96a64e9126386)}, /* 1 + 57/256 */
+        {U64(0x00d0b6a0), U64(0x04b6c4394e14d349), U64(0x8e5a141a35a987a7)}, /* 1 + 58/256 */
+        {U64(0x00d00d01), U64(0x04c98e5388e299b2), U64(0xa1f4300c25aea0c5)}, /* 1 + 59/256 */
+        {U64(0x00cf6475), U64(0x04dc4929ec395e95), U64(0xe5cb8e201f78fbee)}, /* 1 + 60/256 */
+        {U64(0x00cebcf9), U64(0x04eef4e07e668b53), U64(0xaa0ac9761751c63a)}, /* 1 + 61/256 */
+        {U64(0x00ce168a), U64(0x0501919c1f0e5cb6), U64(0x1acf9363d0ec5347)}, /* 1 + 62/256 */
+        {U64(0x00cd7127), U64(0x05141f4900e3ac78), U64(0x0386bf8ba872abb4)}, /* 1 + 63/256 */
+        {U64(0x00cccccd), U64(0x05269e0d2df50a2d), U64(0x5bc68276ed46475c)}, /* 1 + 64/256 */
+        {U64(0x00cc2978), U64(0x05390e2c7d8ccb7f), U64(0xeda7bb41dc5e851b)}, /* 1 + 65/256 */
+        {U64(0x00cb8728), U64(0x054b6f77dc7f5e62), U64(0x64e506b5a75171d2)}, /* 1 + 66/256 */
+        {U64(0x00cae5d8), U64(0x055dc2519ed7aca1), U64(0xddc04e83f8cc2234)}, /* 1 + 67/256 */
+        {U64(0x00ca4588), U64(0x0570068b9c4cb570), U64(0xa231c811ac43f437)}, /* 1 + 68/256 */
+        {U64(0x00c9a634), U64(0x05823c6cadfd0dd1), U64(0xc6a1e011a9d3764e)}, /* 1 + 69/256 */
+        {U64(0x00c907da), U64(0x059464021e2ecf01), U64(0x1f6461fef16c5bef)}, /* 1 + 70/256 */
+        {U64(0x00c86a79), U64(0x05a67d3c3e525030), U64(0xd082cacb30d5294e)}, /* 1 + 71/256 */
+        {U64(0x00c7ce0c), U64(0x05b88881d48fdb53), U64(0x3d26f4e1b0f3e50c)}, /* 1 + 72/256 */
+        {U64(0x00c73294), U64(0x05ca8589429de092), U64(0x1efbc62ffae4522e)}, /* 1 + 73/256 */
+        {U64(0x00c6980c), U64(0x05dc74bae30cbffa), U64(0x1a467fd4f6e06144)}, /* 1 + 74/256 */
+        {U64(0x00c5fe74), U64(0x05ee55eb70bfceab), U64(0x3f9228849ae60092)}, /* 1 + 75/256 */
+        {U64(0x00c565c8), U64(0x0600296732d3b8ca), U64(0x057ff48dab11a61e)}, /* 1 + 76/256 */
+        {U64(0x00c4ce08), U64(0x0611ef039573643f), U64(0xe471b756b280b9c0)}, /* 1 + 77/256 */
+        {U64(0x00c43730), U64(0x0623a70e4adfeeb0), U64(0x23aa3c20f077f931)}, /* 1 + 78/256 */
+        {U64(0x00c3a13e), U64(0x06355199dc9d612f), U64(0x25e7b81c6d55c2a1)}, /* 1 + 79/256 */
+        {U64(0x00c30c31), U64(0x0646ee9b111f73b0), U64(0x1dba0e88968b3c04)}, /* 1 + 80/256 */
+        {U64(0x00c27806), U64(0x06587e43a1f96748), U64(0x22cd72bcfbb33254)}, /* 1 + 81/256 */
+        {U64(0x00c1e4bc), U64(0x066a00893ae12e39), U64(0x0c88e57adab51b4b)}, /* 1 + 82/256 */
+        {U64(0x00c15250), U64(0x067b759ed81dee40), U64(0x799ad2fa066965f1)}, /* 1 + 83/256 */
+        {U64(0x00c0c0c1), U64(0x068cdd7b0cdca833), U64(0x35547adbd6710e75)}, /* 1 + 84/256 */
+        {U64(0x00c0300c), U64(0x069e38521a44daaa), U64(0x07379de54cde4c9f)}, /* 1 + 85/256 */
+        {U64(0x00bfa030), U64(0x06af861b7d1ee5c1), U64(0x234b98e55c10653b)}, /* 1 + 86/256 */
+        {U64(0x00bf112b), U64(0x06c0c6edd00c4865), U64(0x3099bc057ad8318a)}, /* 1 + 87/256 */
+        {U64(0x00be82fa), U64(0x06d1faff3f751e87), U64(0x47ef52c7bd4063b6)}, /* 1 + 88/256 */
+        {U64(0x00bdf59d), U64(0x06e322298ebf146c), U64(0x64663a826f3f7c88)}, /* 1 + 89/256 */
+        {U64(0x00bd6910), U64(0x06f43cc321ded3ba), U64(0xa1300683e9fd1d17)}, /* 1 + 90/256 */
+        {U64(0x00bcdd53), U64(0x07054aa67cc12777), U64(0xc9432782ef19dd63)}, /* 1 + 91/256 */
+        {U64(0x00bc5264), U64(0x07164becbbab4bfd), U64(0xe28ce7441782b159)}, /* 1 + 92/256 */
+        {U64(0x00bbc841), U64(0x072740af8a852840), U64(0x7885f440d625678c)}, /* 1 + 93/256 */
+        {U64(0x00bb3ee7), U64(0x07382928b468f3bf), U64(0x8ebd4f7cce8f2c2c)}, /* 1 + 94/256 */
+        {U64(0x00bab656), U64(0x07490533fed0c21c), U64(0x14cf0a11cb4d3139)}, /* 1 + 95/256 */
+        {U64(0x00ba2e8c), U64(0x0759d4ec8216d40c), U64(0x771c29e03e12d45d)}, /* 1 + 96/256 */
+        {U64(0x00b9a786), U64(0x076a988dbc661bc3), U64(0xcf4f54b6b0eaf175)}, /* 1 + 97/256 */
+        {U64(0x00b92144), U64(0x077b4ff457e357ed), U64(0x3557541fca93a94a)}, /* 1 + 98/256 */
+        {U64(0x00b89bc3), U64(0x078bfb5cdfe9c6b4), U64(0x1decbecc4370a625)}, /* 1 + 99/256 */
+        {U64(0x00b81703), U64(0x079c9aa4822cef76), U64(0xe259c540be26a609)}, /* 1 + 100/256 */
+        {U64(0x00b79301), U64(0x07ad2e08d8f1ca76), U64(0xb638b8793b3730a7)}, /* 1 + 101/256 */
+        {U64(0x00b70fbb), U64(0x07bdb5a826b1aeb6), U64(0x73ca33860633f490)}, /* 1 + 102/256 */
+        {U64(0x00b68d31), U64(0x07ce31608442acfd), U64(0xe8e22f91155b74c6)}, /* 1 + 103/256 */
+        {U64(0x00b60b61), U64(0x07dea150d21cb481), U64(0x7a98db9e82e5e9fd)}, /* 1 + 104/256 */
+        {U64(0x00b58a48), U64(0x07ef05b912937c7e), U64(0x86164972d5249346)}, /* 1 + 105/256 */
+        {U64(0x00b509e7), U64(0x07ff5e57a9339fee), U64(0x936973c64c477a45)}  /* 1 + 106/256 */
+        };
+
+// {2^24 * r, -log2(r) in Q4.124} for c = 1 - i/512, i = 0..150
+static const uint64_t log2_table_down[151][3] =
+        {
+        {U64(0x01000000), U64(0x0000000000000000), U64(0x0000000000000000)}, /* 1 - 0/512 */
+        {U64(0x01008040), U64(0xfff4727b9091bce6), U64(0x87dfb3360f0b932d)}, /* 1 - 1/512 */
+        {U64(0x01010101), U64(0xffe8df2656aac406), U64(0x901e88d09d5e68b9)}, /* 1 - 2/512 */
+        {U64(0x01018243), U64(0xffdd460bf27cf89e), U64(0xc8e6413bd8df21ba)}, /* 1 - 3/512 */
+        {U64(0x01020408), U64(0xffd1a70a2d35900f), U64(0x8c1963f401f3c929)}, /* 1 - 4/512 */
+        {U64(0x01028650), U64(0xffc6022cda9e96b3), U64(0x0689969b7b1dd628)}, /* 1 - 5/512 */
+        {U64(0x0103091b), U64(0xffba577fc5936f16), U64(0x617b3773d56020f0)}, /* 1 - 6/512 */
+        {U64(0x01038c6b), U64(0xffaea6e126f4edfc), U64(0x408cb556f8b66574)}, /* 1 - 7/512 */
+        {U64(0x01041041), U64(0xffa2f04643d8483c), U64(0x8d642604a9dc5e2c)}, /* 1 - 8/512 */
+        {U64(0x0104949d), U64(0xff9733bb33bf7c61), U64(0xf230503046455723)}, /* 1 - 9/512 */
+        {U64(0x0105197f), U64(0xff8b714c04f46863), U64(0x8cfe5ac5f77085d8)}, /* 1 - 10/512 */
+        {U64(0x01059eea), U64(0xff7fa8c0f97ee5a9), U64(0x8db8223016fb8391)}, /* 1 - 11/512 */
+        {U64(0x010624dd), U64(0xff73da3cffa77ccb), U64(0xee5bbd0260bcc87b)}, /* 1 - 12/512 */
+        {U64(0x0106ab5a), U64(0xff68059f5063bb77), U64(0x8ff75229ddfd2845)}, /* 1 - 13/512 */
+        {U64(0x01073261), U64(0xff5c2af45edeacbf), U64(0xa1d6935c31ec0696)}, /* 1 - 14/512 */
+        {U64(0x0107b9f3), U64(0xff504a322c836d9b), U64(0x9f7bebd0826a9c02)}, /* 1 - 15/512 */
+        {U64(0x01084211), U64(0xff44634edf3bc471), U64(0xe1e1fb7ea4b6f9c7)}, /* 1 - 16/512 */
+        {U64(0x0108cabb), U64(0xff387657126ea398), U64(0xb8b0d1ba14bc64b7)}, /* 1 - 17/512 */
+        {U64(0x010953f4), U64(0xff2c831487174a8a), U64(0x8e0787d800b38637)}, /* 1 - 18/512 */
+        {U64(0x0109ddba), U64(0xff2089c0a0ba5a20), U64(0x409c714da762d3f4)}, /* 1 - 19/512 */
+        {U64(0x010a6811), U64(0xff148a0f45daa560), U64(0xb0b4e0d0c3ca48f2)}, /* 1 - 20/512 */
+        {U64(0x010af2f7), U64(0xff088439dd032304), U64(0xc06ecf404d45bad7)}, /* 1 - 21/512 */
+        {U64(0x010b7e6f), U64(0xfefc780af1702271), U64(0xe09f5e05261b858f)}, /* 1 - 22/512 */
+        {U64(0x010c0a78), U64(0xfef065a5bdec377b), U64(0x1965131f91d516cc)}, /* 1 - 23/512 */
+        {U64(0x010c9715), U64(0xfee44cd543a5989b), U64(0x3e3ba033b1efb6d0)}, /* 1 - 24/512 */
+        {U64(0x010d2445), U64(0xfed82dbcd6d88ebf), U64(0x0cd5f3803d95dc83)}, /* 1 - 25/512 */
+        {U64(0x010db20b), U64(0xfecc0827ee4e88f9), U64(0x5b5fb27efae11185)}, /* 1 - 26/512 */
+        {U64(0x010e4065), U64(0xfebfdc4fd50600dd), U64(0xcff30251dcec8d94)}, /* 1 - 27/512 */
+        {U64(0x010ecf57), U64(0xfeb3a9ea824dbdab), U64(0xe3676cae9ae07f55)}, /* 1 - 28/512 */
+        {U64(0x010f5ee0), U64(0xfea7711b7c3cc6dc), U64(0x5ee5b7d647ba2caf)}, /* 1 - 29/512 */
+        {U64(0x010fef01), U64(0xfe9b31da99d8198c), U64(0x6da29a956b999081)}, /* 1 - 30/512 */
+        {U64(0x01107fbc), U64(0xfe8eec0a25e39ab2), U64(0x0d9f312b634defed)}, /* 1 - 31/512 */
+        {U64(0x01111111), U64(0xfe829fb80458c197), U64(0xcf1f4368ce8b31ba)}, /* 1 - 32/512 */
+        {U64(0x0111a302), U64(0xfe764cc6dd43848a), U64(0x6e540350deaac410)}, /* 1 - 33/512 */
+        {U64(0x0112358e), U64(0xfe69f35a506932fb), U64(0x58e557d2e74311e1)}, /* 1 - 34/512 */
+        {U64(0x0112c8b9), U64(0xfe5d932a3d78bf04), U64(0xc5320c17926f5801)}, /* 1 - 35/512 */
+        {U64(0x01135c81), U64(0xfe512c6ff4189046), U64(0xaa1ed4bb94b0c9e0)}, /* 1 - 36/512 */
+        {U64(0x0113f0e9), U64(0xfe44bef948e7b42a), U64(0xb168bd92713db1e7)}, /* 1 - 37/512 */
+        {U64(0x011485f1), U64(0xfe384ad4ab87cd60), U64(0x5aea866e7e4e540c)}, /* 1 - 38/512 */
+        {U64(0x01151b9a), U64(0xfe2bcffb2cc2a0d6), U64(0x8c27d37f4fe5ba7e)}, /* 1 - 39/512 */
+        {U64(0x0115b1e6), U64(0xfe1f4e50b825ef73), U64(0x3b56a2ff2a2aee6d)}, /* 1 - 40/512 */
+        {U64(0x011648d5), U64(0xfe12c5e401d89f9a), U64(0x3067969f24fb7e2b)}, /* 1 - 41/512 */
+        {U64(0x0116e069), U64(0xfe06369950f44f4b), U64(0x78014dd6de900e2b)}, /* 1 - 42/512 */
+        {U64(0x011778a2), U64(0xfdf9a07f86cd2a40), U64(0x2c6a1ade201b1724)}, /* 1 - 43/512 */
+        {U64(0x01181181), U64(0xfded03905f1359a2), U64(0x1ace58f12ae4765c)}, /* 1 - 44/512 */
+        {U64(0x0118ab08), U64(0xfde05fb0a96d83cf), U64(0xa998172b7739ffea)}, /* 1 - 45/512 */
+        {U64(0x01194538), U64(0xfdd3b4da87ceed33), U64(0xbb004c7ae9b3009e)}, /* 1 - 46/512 */
+        {U64(0x0119e012), U64(0xfdc703083dd3b3c7), U64(0x9945f296dd35bc8b)}, /* 1 - 47/512 */
+        {U64(0x011a7b96), U64(0xfdba4a491bede383), U64(0xe88c36237719f67c)}, /* 1 - 48/512 */
+        {U64(0x011b17c6), U64(0xfdad8a82a65a47ba), U64(0x0c4aabe3684615b8)}, /* 1 - 49/512 */
+        {U64(0x011bb4a4), U64(0xfda0c39ab0d56382), U64(0x2312fb481ec8f0bb)}, /* 1 - 50/512 */
+        {U64(0x011c5230), U64(0xfd93f5a0efd0a78f), U64(0x4906bd186944c2f1)}, /* 1 - 51/512 */
+        {U64(0x011cf06b), U64(0xfd8720904d90bab0), U64(0x2a1c15be84f29c46)}, /* 1 - 52/512 */
+        {U64(0x011d8f56), U64(0xfd7a4463d5592668), U64(0x88e5e3146c398e1a)}, /* 1 - 53/512 */
+        {U64(0x011e2ef4), U64(0xfd6d60ed673d2359), U64(0x9477d76240426c02)}, /* 1 - 54/512 */
+        {U64(0x011ecf44), U64(0xfd607651ca61ac42), U64(0x54ef612646c378b3)}, /* 1 - 55/512 */
+        {U64(0x011f7048), U64(0xfd538477dd617d47), U64(0x294ae7c4bba7aa5e)}, /* 1 - 56/512 */
+        {U64(0x01201201), U64(0xfd468b5b50f21541), U64(0x531c5f76cb3a755d)}, /* 1 - 57/512 */
+        {U64(0x0120b471), U64(0xfd398ae37e532b2c), U64(0x4385a32ab64500cd)}, /* 1 - 58/512 */
+        {U64(0x01215798), U64(0xfd2c8320e5dfcfa8), U64(0x59f55f4d862db949)}, /* 1 - 59/512 */
+        {U64(0x0121fb78), U64(0xfd1f73fb386085c6), U64(0x7f9a21d96600ab14)}, /* 1 - 60/512 */
+        {U64(0x0122a012), U64(0xfd125d6eca110d32), U64(0x75582e8eeb26c2b9)}, /* 1 - 61/512 */
+        {U64(0x01234568), U64(0xfd053f63c5639741), U64(0x0ce3d95e5651e0d0)}, /* 1 - 62/512 */
+        {U64(0x0123eb79), U64(0xfcf819ff5d39ecb9), U64(0xa827cd2e9d53e8cc)}, /* 1 - 63/512 */
+        {U64(0x01249249), U64(0xfceaed018ab14686), U64(0xcd9b21592296684b)}, /* 1 - 64/512 */
+        {U64(0x012539d8), U64(0xfcddb87b8d3d926c), U64(0xb8b25078096c2e27)}, /* 1 - 65/512 */
+        {U64(0x0125e227), U64(0xfcd07c6a7a051bb5), U64(0xb0d7ed3bd7d1ec53)}, /* 1 - 66/512 */
+        {U64(0x01268b38), U64(0xfcc338b77573d236), U64(0x74a4c30091929cdc)}, /* 1 - 67/512 */
+        {U64(0x0127350c), U64(0xfcb5ed5ff5b5fbc5), U64(0xea7106361217fee3)}, /* 1 - 68/512 */
+        {U64(0x0127dfa4), U64(0xfca89a618ff70139), U64(0x5e6fe98a8b632df8)}, /* 1 - 69/512 */
+        {U64(0x01288b01), U64(0xfc9b3fb9f83e5a5a), U64(0x9184edbb2b9e3281)}, /* 1 - 70/512 */
+        {U64(0x01293726), U64(0xfc8ddd3f3da410a6), U64(0x4255c28693810476)}, /* 1 - 71/512 */
+        {U64(0x0129e413), U64(0xfc8073036d05fa8a), U64(0xf83ec919d780e635)}, /* 1 - 72/512 */
+        {U64(0x012a91c9), U64(0xfc730104b8c8fc0f), U64(0x4aa4ab891bfb3572)}, /* 1 - 73/512 */
+        {U64(0x012b404b), U64(0xfc658719f3356ff1), U64(0x85a770cd380db9f3)}, /* 1 - 74/512 */
+        {U64(0x012bef99), U64(0xfc580555840b8e23), U64(0x362dbde4e41aa7a3)}, /* 1 - 75/512 */
+        {U64(0x012c9fb5), U64(0xfc4a7ba272a44a64), U64(0x8df6d29d8dadd8f7)}, /* 1 - 76/512 */
+        {U64(0x012d50a0), U64(0xfc3ce9ffaef22ebd), U64(0x74d7e503eaeea82c)}, /* 1 - 77/512 */
+        {U64(0x012e025c), U64(0xfc2f5058b592b09d), U64(0xaa34a7bb78c759b7)}, /* 1 - 78/512 */
+        {U64(0x012eb4ea), U64(0xfc21aeacd45a41a8), U64(0x5bd7fc6e72f1add5)}, /* 1 - 79/512 */
+        {U64(0x012f684c), U64(0xfc1404e7fc8f4cf6), U64(0xa83116f10bdb395a)}, /* 1 - 80/512 */
+        {U64(0x01301c83), U64(0xfc065309d94ad3e8), U64(0x21aeb558df76c399)}, /* 1 - 81/512 */
+        {U64(0x0130d190), U64(0xfbf8991232bc0146), U64(0xda3a508790ac5a89)}, /* 1 - 82/512 */
+        {U64(0x01318776), U64(0xfbead6da3f56d52b), U64(0xde1624bfc8dd1f18)}, /* 1 - 83/512 */
+        {U64(0x01323e35), U64(0xfbdd0c759205b243), U64(0xfe4c7ce222d1f853)}, /* 1 - 84/512 */
+        {U64(0x0132f5cf), U64(0xfbcf39d12ba4f0f5), U64(0xb27a43b94d26ef67)}, /* 1 - 85/512 */
+        {U64(0x0133ae46), U64(0xfbc15eda57abe1ea), U64(0xa8476915c5881424)}, /* 1 - 86/512 */
+        {U64(0x0134679b), U64(0xfbb37b91d52be44e), U64(0x0912c2a394e540d5)}, /* 1 - 87/512 */
+        {U64(0x013521d0), U64(0xfba58fe561b1d151), U64(0x3c37a49fc23edf28)}, /* 1 - 88/512 */
+        {U64(0x0135dce6), U64(0xfb979bd616f872ed), U64(0x15863d272e995a97)}, /* 1 - 89/512 */
+        {U64(0x013698df), U64(0xfb899f5223f3778f), U64(0x79f1be976daae19e)}, /* 1 - 90/512 */
+        {U64(0x013755bd), U64(0xfb7b9a48015719b5), U64(0xa852703ee916f86e)}, /* 1 - 91/512 */
+        {U64(0x01381381), U64(0xfb6d8cb960df7979), U64(0xf67302dd9b8bf036)}, /* 1 - 92/512 */
+        {U64(0x0138d22d), U64(0xfb5f76952b99c075), U64(0x1cc5c7b946c4356f)}, /* 1 - 93/512 */
+        {U64(0x013991c3), U64(0xfb5157ca93ca4c51), U64(0x9d4b3cacb7edcc4f)}, /* 1 - 94/512 */
+        {U64(0x013a5244), U64(0xfb43305be1927092), U64(0x1adb92fc1972f451)}, /* 1 - 95/512 */
+        {U64(0x013b13b1), U64(0xfb35004b77c1c946), U64(0x9fbe9a6eaf6a5378)}, /* 1 - 96/512 */
+        {U64(0x013bd60e), U64(0xfb26c763b2682705), U64(0x3a20dffb64ef428c)}, /* 1 - 97/512 */
+        {U64(0x013c995a), U64(0xfb1885cce56a51a3), U64(0xbaa9ca804aa47c3d)}, /* 1 - 98/512 */
+        {U64(0x013d5d99), U64(0xfb0a3b5209220360), U64(0xe608a4b94b5983e3)}, /* 1 - 99/512 */
+        {U64(0x013e22cc), U64(0xfafbe7f673b1afd5), U64(0xbb94c1280f7af9c2)}, /* 1 - 100/512 */
+        {U64(0x013ee8f4), U64(0xfaed8bbd94f419c8), U64(0xc694cbdcf6cf8d98)}, /* 1 - 101/512 */
+        {U64(0x013fb014), U64(0xfadf2685fe34fcc1), U64(0x803dc35aa1903b7a)}, /* 1 - 102/512 */
+        {U64(0x0140782d), U64(0xfad0b8539765f1f3), U64(0xe61ce9a86fa369bf)}, /* 1 - 103/512 */
+        {U64(0x01414141), U64(0xfac24117fca11ae8), U64(0x85c2a4daf96c8876)}, /* 1 - 104/512 */
+        {U64(0x01420b52), U64(0xfab3c0c51113ae68), U64(0x1c73679e2737f6dc)}, /* 1 - 105/512 */
+        {U64(0x0142d662), U64(0xfaa5374cfec86b0e), U64(0x4dd86c3cd7eba4fd)}, /* 1 - 106/512 */
+        {U64(0x0143a273), U64(0xfa96a4a236716386), U64(0xae07e54308aa1e66)}, /* 1 - 107/512 */
+        {U64(0x01446f86), U64(0xfa8808c9a5fb741e), U64(0xfb9d089cf90a5b06)}, /* 1 - 108/512 */
+        {U64(0x01453d9e), U64(0xfa7963a3fce26247), U64(0xd591998d27152e1a)}, /* 1 - 109/512 */
+        {U64(0x01460cbc), U64(0xfa6ab5369e37476d), U64(0x0dbe235903c10c00)}, /* 1 - 110/512 */
+        {U64(0x0146dce3), U64(0xfa5bfd62dc537e4d), U64(0xd8e7807b92e171c4)}, /* 1 - 111/512 */
+        {U64(0x0147ae14), U64(0xfa4d3c2e8e888d0e), U64(0xf4bac93b8c7a0094)}, /* 1 - 112/512 */
+        {U64(0x01488052), U64(0xfa3e717ba926bc6f), U64(0x0f0ced8fc3ab7b1b)}, /* 1 - 113/512 */
+        {U64(0x0149539e), U64(0xfa2f9d5076d670df), U64(0xa37ab3d61fee381e)}, /* 1 - 114/512 */
+        {U64(0x014a27fb), U64(0xfa20bf8f8cf26990), U64(0xba559aaf89301c9f)}, /* 1 - 115/512 */
+        {U64(0x014afd6a), U64(0xfa11d83fa88a7248), U64(0xea671c2e7df35113)}, /* 1 - 116/512 */
+        {U64(0x014bd3ee), U64(0xfa02e743ff1147a5), U64(0xf334d30db1519002)}, /* 1 - 117/512 */
+        {U64(0x014cab88), U64(0xf9f3eca3bf089759), U64(0x8833591862b52108)}, /* 1 - 118/512 */
+        {U64(0x014d843c), U64(0xf9e4e831052d2191), U64(0xdb064868165dd3c2)}, /* 1 - 119/512 */
+        {U64(0x014e5e0a), U64(0xf9d5da053f613f8a), U64(0x7c38a2ba3bce6c63)}, /* 1 - 120/512 */
+        {U64(0x014f38f6), U64(0xf9c6c1f33f9747a0), U64(0x3b42f5406a34ee1a)}, /* 1 - 121/512 */
+        {U64(0x01501501), U64(0xf9b7a00336dab4e3), U64(0x441555a95958a567)}, /* 1 - 122/512 */
+        {U64(0x0150f22e), U64(0xf9a8741a57988c9f), U64(0x0a91c2462c8d4b6c)}, /* 1 - 123/512 */
+        {U64(0x0151d07f), U64(0xf9993e2fc3270990), U64(0xf9d162e39145f511)}, /* 1 - 124/512 */
+        {U64(0x0152aff5), U64(0xf989fe4c4fcc6d91), U64(0x5000857c3fd0d625)}, /* 1 - 125/512 */
+        {U64(0x01539095), U64(0xf97ab4334b8edfb8), U64(0x5d0dbdf44808170a)}, /* 1 - 126/512 */
+        {U64(0x0154725e), U64(0xf96b6010f5c5585c), U64(0xe5471c2038db819d)}, /* 1 - 127/512 */
+        {U64(0x01555555), U64(0xf95c01a9650f427d), U64(0x84fb7f21b67b6c75)}, /* 1 - 128/512 */
+        {U64(0x0156397c), U64(0xf94c98f5490e48d8), U64(0x2530b57a0c940775)}, /* 1 - 129/512 */
+        {U64(0x01571ed4), U64(0xf93d25fecb3db6f6), U64(0x8a19b0f5793176a8)}, /* 1 - 130/512 */
+        {U64(0x01580560), U64(0xf92da8adccf2f889), U64(0x861a1514a25c8406)}, /* 1 - 131/512 */
+        {U64(0x0158ed23), U64(0xf91e20ea9e139064), U64(0xabf72a852021cee6)}, /* 1 - 132/512 */
+        {U64(0x0159d61f), U64(0xf90e8eaf130a10f6), U64(0xab5586ef328f5dd1)}, /* 1 - 133/512 */
+        {U64(0x015ac057), U64(0xf8fef1e435591f6d), U64(0x09a9e36cf2ab64cf)}, /* 1 - 134/512 */
+        {U64(0x015babcc), U64(0xf8ef4a957a847741), U64(0xb2997dcb09457f8a)}, /* 1 - 135/512 */
+        {U64(0x015c9883), U64(0xf8df988a9a9586de), U64(0xec4f35f5b9a5f7a9)}, /* 1 - 136/512 */
+        {U64(0x015d867c), U64(0xf8cfdbe09f64e545), U64(0xe85c6e2301258358)}, /* 1 - 137/512 */
+        {U64(0x015e75bc), U64(0xf8c0146026504933), U64(0x32b90380185a650e)}, /* 1 - 138/512 */
+        {U64(0x015f6643), U64(0xf8b04226aa780a18), U64(0x905ac4825bc10cc4)}, /* 1 - 139/512 */
+        {U64(0x01605816), U64(0xf8a064fdad47bf64), U64(0x7188c8a1d7f1ba10)}, /* 1 - 140/512 */
+        {U64(0x01614b37), U64(0xf8907ce1a60647c4), U64(0x03dd3a1092dc3ccb)}, /* 1 - 141/512 */
+        {U64(0x01623fa7), U64(0xf88089dff7a00d68), U64(0x1f0edef9e54ea043)}, /* 1 - 142/512 */
+        {U64(0x0163356c), U64(0xf8708bb2e5980dda), U64(0xaab591f1643303cf)}, /* 1 - 143/512 */
+        {U64(0x01642c86), U64(0xf8608279347704af), U64(0x3238767b6613174d)}, /* 1 - 144/512 */
+        {U64(0x016524f8), U64(0xf8506e1fe56dba38), U64(0x87185c949d3d7db7)}, /* 1 - 145/512 */
+        {U64(0x01661ec7), U64(0xf8404e736350feb7), U64(0x9c7310b0b905e3bb)}, /* 1 - 146/512 */
+        {U64(0x016719f3), U64(0xf83023932658f484), U64(0xfcffa0ae52028429)}, /* 1 - 147/512 */
+        {U64(0x01681681), U64(0xf81fed4c77f363cf), U64(0x3f8d6c6a2e20639d)}, /* 1 - 148/512 */
+        {U64(0x01691474), U64(0xf80fab8e220b2625), U64(0xdd681dcf3b493a32)}, /* 1 - 149/512 */
+        {U64(0x016a13cd), U64(0xf7ff5e67fb3f15a6), U64(0x24a690c6f7b3f3d6)}  /* 1 - 150/512 */
+        };
+
+
+/*----------------------------------------------------------------------------
+| Returns log2(1 + u) for |u| < 2^-9 given exactly by `uu' and, possibly
+| truncated, by its Q4.124 form `u'.
+*----------------------------------------------------------------------------*/
+
+static float128 log2p1_small_approximation(float128_unpacked uu, int128_native u) {
+    float128_unpacked up;
+    normalizeFixedToFloat128Unpacked(EvalPolyFixedEstrin(u, log2p1_poly_fixed, LOG2_POLY_SIZE), &up);
+    mulFloat128Unpacked(uu, up, &up);
+    return packFloat128Unpacked(up);
+}
+
+/*----------------------------------------------------------------------------
+| Returns log2(m) for the Q4.124 value sqrt(2)/2 <= m < sqrt(2), whose bits
+| below 2^-100 must be zero.
+*----------------------------------------------------------------------------*/
+
+static float128 log2_table_approximation(int128_native m) {
+    const int128_native one = (int128_native) 1 << FLOAT128_FIXED_FRAC_BITS;
+    int128_native d = m - one;
+    const uint64_t *entry;
+    float128_unpacked uz;
+
+    if (d >= 0)
+        entry = log2_table_up[(int) ((d + ((int128_native) 1 << (FLOAT128_FIXED_FRAC_BITS - 9))) >> (FLOAT128_FIXED_FRAC_BITS - 8))];
+    else
+        entry = log2_table_down[(int) ((-d + ((int128_native) 1 << (FLOAT128_FIXED_FRAC_BITS - 10))) >> (FLOAT128_FIXED_FRAC_BITS - 9))];
+
+    if (entry[0] == (U64(1) << LOG2_RECIP_FRAC_BITS)) {
+        if (d == 0) return packFloat128(0, 0, 0, 0);
+        normalizeFixedToFloat128Unpacked(d, &uz);
+        return log2p1_small_approximation(uz, d);
+    }
+
+    int128_native u = (int128_native) mul128To256ShiftRight(m, entry[0], LOG2_RECIP_FRAC_BITS) - one;
+    normalizeFixedToFloat128Unpacked((int128_native) pack128(entry[1], entry[2]) + mulFixed(u, EvalPolyFixedEstrin(u, log2p1_poly_fixed, LOG2_POLY_SIZE)), &uz);
+    return packFloat128Unpacked(uz);
+}
+
+#endif
+
 // =================================================
 // FYL2X                   Compute y * log (x)
 //                                        2
@@ -6009,10 +7121,14 @@ floatx80 fyl2x(floatx80 a, floatx80 b, float_status_t *status) {
     /* using float128 for approximation */
     /* ******************************** */
 
+#ifdef LIBX87_TABLE_KERNELS
+    float128 x = log2_table_approximation((int128_native) aSig << (FLOAT128_FIXED_FRAC_BITS - 63 + aExp));
+#else
     uint64_t zSig0, zSig1;
     shift128Right(aSig << 1, 0, 16, &zSig0, &zSig1);
     float128 x = packFloat128(0, aExp + 0x3FFF, zSig0, zSig1);
     x = poly_l2(x, status);
+#endif
     x = float128_add(x, int64_to_float128((int64_t) ExpDiff), status);
     return floatx80_mul_with_float128(b, x, status);
 }
@@ -6106,7 +7222,12 @@ floatx80 fyl2xp1(floatx80 a, floatx80 b, float_status_t *status) {
     if (aSign && aExp >= 0x3FFF)
         return a;
 
+#ifdef LIBX87_TABLE_KERNELS
+    // 1 + a is formed exactly in fixed point below, for any |a| <= 1 - sqrt(2)/2
+    if (aExp > 0x3FFD || (aExp == 0x3FFD && aSig > U64(0x95F619980C4336F7))) // big argument
+#else
     if (aExp >= 0x3FFC) // big argument
+#endif
     {
         return fyl2x(floatx80_add(a, floatx80_one, status), b, status);
     }
@@ -6137,9 +7258,24 @@ floatx80 fyl2xp1(floatx80 a, floatx80 b, float_status_t *status) {
     /* using float128 for approximation */
     /* ******************************** */
 
+#ifdef LIBX87_TABLE_KERNELS
+    float128 x;
+    int128_native u = ((int128_native) aSig << (FLOAT128_FIXED_FRAC_BITS - 63)) >> (0x3FFF - aExp);
+    if (aSign) u = -u;
+    if (aExp < 0x3FFF - 10) {
+        float128_unpacked ua;
+        ua.sign = aSign;
+        ua.exp = aExp;
+        ua.sig = (uint128_native) aSig << 49;
+        x = log2p1_small_approximation(ua, u);
+    } else {
+        x = log2_table_approximation(((int128_native) 1 << FLOAT128_FIXED_FRAC_BITS) + u);
+    }
+#else
     shift128Right(aSig << 1, 0, 16, &zSig0, &zSig1);
     float128 x = packFloat128(aSign, aExp, zSig0, zSig1);
     x = poly_l2p1(x, status);
+#endif
     return floatx80_mul_with_float128(b, x, status);
 }
 
@@ -6172,6 +7308,32 @@ these four paragraphs for those parts of this code that are retained.
 
 #define USE_estimateDiv128To64 // ?? needed?
 
+/*----------------------------------------------------------------------------
+| Returns exactly the same estimate as estimateDiv128To64(a0, a1, FLOAT_PI_HI)
+| for a0 < FLOAT_PI_HI.  With the divisor known at compile time both 64 by
+| 32-bit divisions become multiplications by a reciprocal, which takes the
+| hardware divider out of the argument reduction for every exponent.  The
+| reduced argument depends on this estimate through the low word of the
+| product below, so it must not be replaced by a better one.
+*----------------------------------------------------------------------------*/
+
+BX_CPP_INLINE uint64_t estimateDiv128ToPi(uint64_t a0, uint64_t a1)
+{
+    const uint64_t b = FLOAT_PI_HI, b0 = FLOAT_PI_HI>>32;
+    uint64_t rem0, rem1, term0, term1;
+
+    uint64_t z = (b0<<32 <= a0) ? U64(0xFFFFFFFF00000000) : (a0 / b0)<<32;
+    mul64To128(b, z, &term0, &term1);
+    sub128(a0, a1, term0, term1, &rem0, &rem1);
+    while (((int64_t) rem0) < 0) {
+        z -= U64(0x100000000);
+        add128(rem0, rem1, b0, b<<32, &rem0, &rem1);
+    }
+    rem0 = (rem0<<32) | (rem1>>32);
+    z |= (b0<<32 <= rem0) ? 0xFFFFFFFF : rem0 / b0;
+    return z;
+}
+
 /* reduce trigonometric function argument using 128-bit precision
    M_PI approximation */
 static uint64_t argument_reduction_kernel(uint64_t aSig0, int Exp, uint64_t *zSig0, uint64_t *zSig1) {
@@ -6179,7 +7341,7 @@ static uint64_t argument_reduction_kernel(uint64_t aSig0, int Exp, uint64_t *zSi
     uint64_t aSig1 = 0;
 
     shortShift128Left(aSig1, aSig0, Exp, &aSig1, &aSig0);
-    uint64_t q = estimateDiv128To64(aSig1, aSig0, FLOAT_PI_HI);
+    uint64_t q = estimateDiv128ToPi(aSig1, aSig0);
     mul128By64To192(FLOAT_PI_HI, FLOAT_PI_LO, q, &term0, &term1, &term2);
     sub128(aSig1, aSig0, term0, term1, zSig1, zSig0);
     while ((int64_t) (*zSig1) < 0) {
@@ -6228,40 +7390,10 @@ static int reduce_trig_arg(int expDiff, int *zSign_input, uint64_t *aSig0_input,
     return (int) (q & 3);
 }
 
-#define SIN_ARR_SIZE 11
-#define COS_ARR_SIZE 11
 
-static float128 sin_arr[SIN_ARR_SIZE] =
-        {
-                PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
-                PACK_FLOAT_128(0xbffc555555555555, 0x5555555555555555), /*  3 */
-                PACK_FLOAT_128(0x3ff8111111111111, 0x1111111111111111), /*  5 */
-                PACK_FLOAT_128(0xbff2a01a01a01a01, 0xa01a01a01a01a01a), /*  7 */
-                PACK_FLOAT_128(0x3fec71de3a556c73, 0x38faac1c88e50017), /*  9 */
-                PACK_FLOAT_128(0xbfe5ae64567f544e, 0x38fe747e4b837dc7), /* 11 */
-                PACK_FLOAT_128(0x3fde6124613a86d0, 0x97ca38331d23af68), /* 13 */
-                PACK_FLOAT_128(0xbfd6ae7f3e733b81, 0xf11d8656b0ee8cb0), /* 15 */
-                PACK_FLOAT_128(0x3fce952c77030ad4, 0xa6b2605197771b00), /* 17 */
-                PACK_FLOAT_128(0xbfc62f49b4681415, 0x724ca1ec3b7b9675), /* 19 */
-                PACK_FLOAT_128(0x3fbd71b8ef6dcf57, 0x18bef146fcee6e45)  /* 21 */
-        };
 
-static float128 cos_arr[COS_ARR_SIZE] =
-        {
-                PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  0 */
-                PACK_FLOAT_128(0xbffe000000000000, 0x0000000000000000), /*  2 */
-                PACK_FLOAT_128(0x3ffa555555555555, 0x5555555555555555), /*  4 */
-                PACK_FLOAT_128(0xbff56c16c16c16c1, 0x6c16c16c16c16c17), /*  6 */
-                PACK_FLOAT_128(0x3fefa01a01a01a01, 0xa01a01a01a01a01a), /*  8 */
-                PACK_FLOAT_128(0xbfe927e4fb7789f5, 0xc72ef016d3ea6679), /* 10 */
-                PACK_FLOAT_128(0x3fe21eed8eff8d89, 0x7b544da987acfe85), /* 12 */
-                PACK_FLOAT_128(0xbfda93974a8c07c9, 0xd20badf145dfa3e5), /* 14 */
-                PACK_FLOAT_128(0x3fd2ae7f3e733b81, 0xf11d8656b0ee8cb0), /* 16 */
-                PACK_FLOAT_128(0xbfca6827863b97d9, 0x77bb004886a2c2ab), /* 18 */
-                PACK_FLOAT_128(0x3fc1e542ba402022, 0x507a9cad2bf8f0bb)  /* 20 */
-        };
 
-extern float128 OddPoly(float128 x, float128 *arr, int n, float_status_t *status);
+extern float128 OddPoly(float128 x, const float128 *arr, int n, float_status_t *status);
 
 /* 0 <= x <= pi/4 */
 BX_CPP_INLINE float128 poly_sin(float128 x, float_status_t *status) {
@@ -6288,7 +7420,7 @@ BX_CPP_INLINE float128 poly_sin(float128 x, float_status_t *status) {
     return OddPoly(x, sin_arr, SIN_ARR_SIZE, status);
 }
 
-extern float128 EvenPoly(float128 x, float128 *arr, int n, float_status_t *status);
+extern float128 EvenPoly(float128 x, const float128 *arr, int n, float_status_t *status);
 
 /* 0 <= x <= pi/4 */
 BX_CPP_INLINE float128 poly_cos(float128 x, float_status_t *status) {
@@ -6310,6 +7442,215 @@ BX_CPP_INLINE float128 poly_cos(float128 x, float_status_t *status) {
     return EvenPoly(x, cos_arr, COS_ARR_SIZE, status);
 }
 
+#ifdef LIBX87_TABLE_KERNELS
+
+/*----------------------------------------------------------------------------
+| Table-driven sine and cosine of a reduced argument 0 <= r <= pi/4.  `r' is
+| split into the nearest breakpoint k/64 and a remainder |d| <= 1/128, and
+|
+|     sin(r) = sin(k/64) * cos(d) + cos(k/64) * sin(d)
+|     cos(r) = cos(k/64) * cos(d) - sin(k/64) * sin(d)
+|
+| where sin(d)/d and cos(d) are six-term Taylor polynomials in d^2, whose
+| truncation error is below 2^-110.  Everything is computed in Q4.124 (see
+| `EvalPolyFixed'), except that for k = 0 sin(r) is formed as r * sin(d)/d
+| in floating point, so that it keeps its relative precision for tiny r.
+*----------------------------------------------------------------------------*/
+
+#define SINCOS_TABLE_STEP_BITS 6
+#define SINCOS_TABLE_SIZE 51
+
+// sin(k/64) and cos(k/64) in Q4.124 as {sin hi, sin lo, cos hi, cos lo}
+static const uint64_t sincos_table[SINCOS_TABLE_SIZE][4] =
+        {
+        {U64(0x0000000000000000), U64(0x0000000000000000), U64(0x1000000000000000), U64(0x0000000000000000)}, /*  0 */
+        {U64(0x003fff5555dddda9), U64(0xdaa938cac1f113dd), U64(0x0fff8000aaaa4fa5), U64(0x14514074bde6ace4)}, /*  1 */
+        {U64(0x007ffaaabbbba1ba), U64(0x32bf904ddb51e465), U64(0x0ffe000aaa93e958), U64(0x9576da4ec94946fc)}, /*  2 */
+        {U64(0x00bfee008197dd45), U64(0x4cc841722cd0cc47), U64(0x0ffb8035fefccf67), U64(0x4c4a9f9b72a14183)}, /*  3 */
+        {U64(0x00ffd557776a76d5), U64(0xa5d259b2f692d4ad), U64(0x0ff800aaa4fa69a6), U64(0x5070f73284de215c)}, /*  4 */
+        {U64(0x013facb12d1755a9), U64(0xb79bab59ae5d278d), U64(0x0ff381a094f7b771), U64(0xa05e641b4834be06)}, /*  5 */
+        {U64(0x017f701032550e41), U64(0xafc2d1800501a100), U64(0x0fee035fbf35cda6), U64(0x32056a6bf1b6b28e)}, /*  6 */
+        {U64(0x01bf1b78568391d7), U64(0xa461077a9331f296), U64(0x0fe78640074cd88f), U64(0x51ebc368c35611b3)}, /*  7 */
+        {U64(0x01feaaeee86ee35c), U64(0xa069a86721f89f86), U64(0x0fe00aa93eade9b6), U64(0xd1e6a129df6f18ce)}, /*  8 */
+        {U64(0x023e1a7af5f9d5d4), U64(0x88357b344b2da518), U64(0x0fd791131e25e97a), U64(0xb54c7b317625d2cc)}, /*  9 */
+        {U64(0x027d66258bacd96a), U64(0x3eb335b365c87d59), U64(0x0fce1a053e621438), U64(0xb6d60c76e8c45bf1)}, /* 10 */
+        {U64(0x02bc89f9f424de54), U64(0x85de7ce03b251495), U64(0x0fc3a6170f767ac7), U64(0x35d63d99a9d439e2)}, /* 11 */
+        {U64(0x02fb8205f75e56a2), U64(0xb56a1c4792f85626), U64(0x0fb835efcf670dd2), U64(0xce6fe7924697eea1)}, /* 12 */
+        {U64(0x033a4a5a19d86246), U64(0x710f602c44df4fa5), U64(0x0fabca467fb3cb8f), U64(0x1d069f01d8ea33ae)}, /* 13 */
+        {U64(0x0378df09db8c332c), U64(0xe0d2b53d865582e4), U64(0x0f9e63e1d9e8b6f6), U64(0xf2e296bae5b5ed9c)}, /* 14 */
+        {U64(0x03b73c2bf6b4b9f6), U64(0x68ef9499c81f0d96), U64(0x0f90039843324f9b), U64(0x940416c1984b6cbf)}, /* 15 */
+        {U64(0x03f55dda9e62aed7), U64(0x513bd7b8e6a3d163), U64(0x0f80aa4fbef750ba), U64(0x783d33cb95f94f8a)}, /* 16 */
+        {U64(0x04334033bcd90d66), U64(0x04f5f36c1d4b8445), U64(0x0f7058fde0788dfc), U64(0x805b8fe88789e4f4)}, /* 17 */
+        {U64(0x0470df5931ae1d94), U64(0x6076fe0dcff47fe3), U64(0x0f5f10a7bb77d3df), U64(0xa0c1da8b57842783)}, /* 18 */
+        {U64(0x04ae37710fad27c8), U64(0xaa9c4cf96c03519c), U64(0x0f4cd261d3e6c15b), U64(0xb369c8758630d2ac)}, /* 19 */
+        {U64(0x04eb44a5da74f600), U64(0x207aaa090f0734e3), U64(0x0f399f500c9e9fd3), U64(0x7ae9957263dab887)}, /* 20 */
+        {U64(0x05280326c3cf4818), U64(0x23ba6bb08eac82c2), U64(0x0f2578a595224dd2), U64(0xe6bfa2eb2f99cc67)}, /* 21 */
+        {U64(0x05646f27e8bd65cb), U64(0xe3a5d61ff0657229), U64(0x0f105fa4d66b607a), U64(0x67d44e0427252044)}, /* 22 */
+        {U64(0x05a084e28e35fda2), U64(0x776dfdbbb5531d75), U64(0x0efa559f5ec3aec3), U64(0xa4eb03319278a2d4)}, /* 23 */
+        {U64(0x05dc40955d9084f4), U64(0x8a94675a2498de5e), U64(0x0ee35bf5ccac8905), U64(0x2cd91ddb734d3a48)}, /* 24 */
+        {U64(0x06179e84a09a5258), U64(0xa40e9b5face03e52), U64(0x0ecb7417b8d4ee3f), U64(0xec37aba4073aa48f)}, /* 25 */
+        {U64(0x06529afa7d51b129), U64(0x631ec197c0a840a1), U64(0x0eb29f839f201fd1), U64(0x3b93796827916a79)}, /* 26 */
+        {U64(0x068d324731433279), U64(0x73bc712bcc4ccddc), U64(0x0e98dfc6c6be031e), U64(0x60dd3089cbdd18a7)}, /* 27 */
+        {U64(0x06c760c14c8585a5), U64(0x1dbd34660ae6c52b), U64(0x0e7e367d2956cfb1), U64(0x6b6aa11e5419cd00)}, /* 28 */
+        {U64(0x070122c5ec5028c8), U64(0xcff33abf4fd340cd), U64(0x0e62a551594b970a), U64(0x770b15d41d4c0e48)}, /* 29 */
+        {U64(0x073a74b8f52947b6), U64(0x81baf6928eb3fb02), U64(0x0e462dfc670d421a), U64(0xb3d1a15901228f14)}, /* 30 */
+        {U64(0x077353054ca72690), U64(0xd4c6e171fd99e6b4), U64(0x0e28d245c58baef7), U64(0x2225e232abc003c4)}, /* 31 */
+        {U64(0x07abba1d12c17bfa), U64(0x1d92f0d93f60deda), U64(0x0e0a94032dbea7ce), U64(0xdbddd9da2fafad98)}, /* 32 */
+        {U64(0x07e3a679daaf25c6), U64(0x76542bcb4028d096), U64(0x0deb7518814a7a93), U64(0x1bbcc88c109cd41c)}, /* 33 */
+        {U64(0x081b149ce34caa5a), U64(0x4e650f8d09fd4d6b), U64(0x0dcb7777ac420705), U64(0x168f31e3eb780cea)}, /* 34 */
+        {U64(0x0852010f4f080052), U64(0x1378bd8dd614753d), U64(0x0daa9d2086082706), U64(0x3fde51c09e855e99)}, /* 35 */
+        {U64(0x088868625b4e1dbb), U64(0x2313310133022527), U64(0x0d88e820b1526311), U64(0xdd561efbc0c1a9a5)}, /* 36 */
+        {U64(0x08be472f9776d809), U64(0xaf2b88171243d63d), U64(0x0d665a937b4ef2b1), U64(0xf6d51bad6d988a44)}, /* 37 */
+        {U64(0x08f39a191b2ba612), U64(0x2a3fa4f41d5a3ffd), U64(0x0d42f6a1b9f0168c), U64(0xdf031c2f63c8d930)}, /* 38 */
+        {U64(0x09285dc9bc45dd9e), U64(0xa3d02457bcce59c4), U64(0x0d1ebe81a95ee752), U64(0xe48a26bcd32d6e92)}, /* 39 */
+        {U64(0x095c8ef544210ec0), U64(0xb91c49bd2aa09e85), U64(0x0cf9b476c897c25c), U64(0x5bfe750dd3f308eb)}, /* 40 */
+        {U64(0x09902a58a45e27be), U64(0xd68412b426b675ed), U64(0x0cd3dad1b5328a2e), U64(0x459f993f4f510882)}, /* 41 */
+        {U64(0x09c32cba2b14156e), U64(0xf05256c4f857991d), U64(0x0cad33f00658fe5e), U64(0x8204bbc0f3a66a0e)}, /* 42 */
+        {U64(0x09f592e9b66a9cf9), U64(0x06a3c7aa3c101998), U64(0x0c85c23c26ed7b6f), U64(0x014ef546c4792968)}, /* 43 */
+        {U64(0x0a2759c0e79c3558), U64(0x2527c32b55f5405c), U64(0x0c5d882d2ee48030), U64(0xc7c07d28e981e348)}, /* 44 */
+        {U64(0x0a587e23555bb080), U64(0x86d02b9c662cdd29), U64(0x0c348846bbd36313), U64(0x38ffe2bfe9dd1382)}, /* 45 */
+        {U64(0x0a88fcfebd9a8dd4), U64(0x7e2f3c76ef9e243a), U64(0x0c0ac518c8b6ae71), U64(0x0ba37a3eeb90cb16)}, /* 46 */
+        {U64(0x0ab8d34b36acd987), U64(0x210ed343ec65d7e4), U64(0x0be0413f84f2a771), U64(0xc614946a88cbf4da)}, /* 47 */
+        {U64(0x0ae7fe0b5fc786b2), U64(0xd966e1d6af140a49), U64(0x0bb4ff632a908f73), U64(0xec151839cb9d993b)}, /* 48 */
+        {U64(0x0b167a4c90d63c42), U64(0x44cf5493b7cc23bd), U64(0x0b890237d3bb3c28), U64(0x4b614a0539016bfa)}, /* 49 */
+        {U64(0x0b44452709a59752), U64(0x905913765434a59d), U64(0x0b5c4c7d4f7dae91), U64(0x5ac786ccf4b1a499)}  /* 50 */
+        };
+
+
+
+/*----------------------------------------------------------------------------
+| Stores sin(r) into `sin_r' and cos(r) into `cos_r', either of which may be
+| null.  Returns 0, leaving them alone, if `r' is not a normal number in the
+| range of the table.
+*----------------------------------------------------------------------------*/
+
+static int sincos_table_approximation(float128 r, float128 *sin_r, float128 *cos_r) {
+    const int stepShift = FLOAT128_FIXED_FRAC_BITS - SINCOS_TABLE_STEP_BITS;
+    float128_unpacked ur, uz;
+    int128_native x;
+
+    if (!unpackFloat128PolyArgument(r, &ur, &x) || ur.sign) return 0;
+    int k = (int) ((x + ((int128_native) 1 << (stepShift - 1))) >> stepShift);
+    if (k >= SINCOS_TABLE_SIZE) return 0;
+
+    int128_native d = x - ((int128_native) k << stepShift);
+    int128_native d2 = mulFixed(d, d);
+    int128_native sinD = EvalPolyFixedHorner(d2, sin_poly_fixed, SINCOS_POLY_SIZE); // sin(d)/d
+    int128_native cosD = EvalPolyFixedHorner(d2, cos_poly_fixed, SINCOS_POLY_SIZE);
+
+    if (k == 0) {
+        if (sin_r) {
+            if (!fixedToFloat128Unpacked(sinD, &uz)) return 0;
+            mulFloat128Unpacked(ur, uz, &uz);
+            *sin_r = packFloat128Unpacked(uz);
+        }
+        if (cos_r) {
+            if (!fixedToFloat128Unpacked(cosD, &uz)) return 0;
+            *cos_r = packFloat128Unpacked(uz);
+        }
+        return 1;
+    }
+
+    const uint64_t *entry = sincos_table[k];
+    int128_native sinK = (int128_native) pack128(entry[0], entry[1]);
+    int128_native cosK = (int128_native) pack128(entry[2], entry[3]);
+    sinD = mulFixed(sinD, d);
+    if (sin_r) {
+        if (!fixedToFloat128Unpacked(mulFixed(sinK, cosD) + mulFixed(cosK, sinD), &uz)) return 0;
+        *sin_r = packFloat128Unpacked(uz);
+    }
+    if (cos_r) {
+        if (!fixedToFloat128Unpacked(mulFixed(cosK, cosD) - mulFixed(sinK, sinD), &uz)) return 0;
+        *cos_r = packFloat128Unpacked(uz);
+    }
+    return 1;
+}
+
+/*----------------------------------------------------------------------------
+| Divides the positive Q4.124 value `a' by the positive Q4.124 value `b' and
+| rounds the quotient to quadruple precision.  `b' is scaled into [1, 2) and
+| its reciprocal refined by three Newton steps from a 64-bit division; the
+| quotient must be at least 2^-8 before the scaling is undone.
+*----------------------------------------------------------------------------*/
+
+static void divFixedToFloat128Unpacked(int128_native a, int128_native b, float128_unpacked *z) {
+    const int128_native one = (int128_native) 1 << FLOAT128_FIXED_FRAC_BITS;
+    int shiftCount = countLeadingZeros64((uint64_t) (b>>64)) - (127 - FLOAT128_FIXED_FRAC_BITS);
+    b <<= shiftCount;
+
+    uint64_t bHi = (uint64_t) (b >> (FLOAT128_FIXED_FRAC_BITS - 31));
+    int128_native r = (int128_native) ((U64(1) << 63) / bHi) << (FLOAT128_FIXED_FRAC_BITS - 32);
+    for (int n = 0; n < 3; n++)
+        r += mulFixed(r, one - mulFixed(b, r));
+
+    normalizeFixedToFloat128Unpacked(mulFixed(a, r), z);
+    z->exp += shiftCount;
+}
+
+
+
+
+/*----------------------------------------------------------------------------
+| Stores tan(r), or cot(r) if `cot' is set, into `z' for the reduced
+| argument 0 <= r <= pi/4, using the breakpoints of the sine and cosine
+| table: sin(r) and cos(r) are formed as in `sincos_table_approximation'
+| and divided in fixed point.  Close to zero, where k = 0, the Taylor series
+| of tan(r)/r and r*cot(r) in r^2 take over, so that the result keeps its
+| relative precision.  Returns 0 if `r' is out of the range of the table.
+*----------------------------------------------------------------------------*/
+
+static int tan_table_approximation(float128 r, int cot, float128 *z) {
+    const int stepShift = FLOAT128_FIXED_FRAC_BITS - SINCOS_TABLE_STEP_BITS;
+    float128_unpacked ur, uz;
+    int128_native x;
+
+    if (!unpackFloat128PolyArgument(r, &ur, &x) || ur.sign) return 0;
+    int k = (int) ((x + ((int128_native) 1 << (stepShift - 1))) >> stepShift);
+    if (k >= SINCOS_TABLE_SIZE) return 0;
+
+    if (k == 0) {
+        int128_native u = mulFixed(x, x);
+        if (cot) {
+            // (r*cot(r)) / r, with the significand of r as the divisor
+            divFixedToFloat128Unpacked(EvalPolyFixedEstrin(u, cot_poly_fixed, TAN_POLY_SIZE),
+                                       (int128_native) (ur.sig << (FLOAT128_FIXED_FRAC_BITS - 112)), &uz);
+            uz.exp += 0x3FFF - ur.exp;
+        } else {
+            normalizeFixedToFloat128Unpacked(EvalPolyFixedEstrin(u, tan_poly_fixed, TAN_POLY_SIZE), &uz);
+            mulFloat128Unpacked(ur, uz, &uz);
+        }
+        *z = packFloat128Unpacked(uz);
+        return 1;
+    }
+
+    int128_native d = x - ((int128_native) k << stepShift);
+    int128_native d2 = mulFixed(d, d);
+    int128_native sinD = mulFixed(EvalPolyFixedHorner(d2, sin_poly_fixed, SINCOS_POLY_SIZE), d);
+    int128_native cosD = EvalPolyFixedHorner(d2, cos_poly_fixed, SINCOS_POLY_SIZE);
+
+    const uint64_t *entry = sincos_table[k];
+    int128_native sinK = (int128_native) pack128(entry[0], entry[1]);
+    int128_native cosK = (int128_native) pack128(entry[2], entry[3]);
+    int128_native sinR = mulFixed(sinK, cosD) + mulFixed(cosK, sinD);
+    int128_native cosR = mulFixed(cosK, cosD) - mulFixed(sinK, sinD);
+
+    if (cot) divFixedToFloat128Unpacked(cosR, sinR, &uz);
+    else divFixedToFloat128Unpacked(sinR, cosR, &uz);
+    *z = packFloat128Unpacked(uz);
+    return 1;
+}
+
+#endif
+
+/* 0 <= x <= pi/4, either result may be null */
+static void poly_sincos(float128 x, float128 *sin_x, float128 *cos_x, float_status_t *status) {
+#ifdef LIBX87_TABLE_KERNELS
+    if (sincos_table_approximation(x, sin_x, cos_x)) return;
+#endif
+    if (sin_x) *sin_x = poly_sin(x, status);
+    if (cos_x) *cos_x = poly_cos(x, status);
+}
+
 BX_CPP_INLINE void sincos_invalid(floatx80 *sin_a, floatx80 *cos_a, floatx80 a) {
     if (sin_a) *sin_a = a;
     if (cos_a) *cos_a = a;
@@ -6320,12 +7661,13 @@ BX_CPP_INLINE void sincos_tiny_argument(floatx80 *sin_a, floatx80 *cos_a, floatx
     if (cos_a) *cos_a = floatx80_one;
 }
 
-static floatx80 sincos_approximation(int neg, float128 r, uint64_t quotient, float_status_t *status) {
+static floatx80 sincos_approximation(int neg, float128 sin_r, float128 cos_r, uint64_t quotient, float_status_t *status) {
+    float128 r;
     if (quotient & 0x1) {
-        r = poly_cos(r, status);
+        r = cos_r;
         neg = 0;
     } else {
-        r = poly_sin(r, status);
+        r = sin_r;
     }
 
     floatx80 result = float128_to_floatx80(r, status);
@@ -6423,6 +7765,8 @@ int fsincos(floatx80 a, floatx80 *sin_a, floatx80 *cos_a, float_status_t *status
             return 0;
         }
         zExp = aExp;
+    } else if (expDiff == -1 && aSig0 <= FLOAT_PI_HI) {    // |a| < pi/4 doesn't either
+        zExp = aExp;
     } else {
         q = reduce_trig_arg(expDiff, &zSign, &aSig0, &aSig1);
     }
@@ -6435,8 +7779,14 @@ int fsincos(floatx80 a, floatx80 *sin_a, floatx80 *cos_a, float_status_t *status
     float128 r = normalizeRoundAndPackFloat128(0, zExp - 0x10, aSig0, aSig1, status);
 
     if (aSign) q = -q;
-    if (sin_a) *sin_a = sincos_approximation(zSign, r, q, status);
-    if (cos_a) *cos_a = sincos_approximation(zSign, r, q + 1, status);
+
+    // sin(x) takes sin(r) for an even quotient and cos(r) for an odd one, cos(x) the other
+    float128 sin_r = r, cos_r = r;
+    int odd = q & 1;
+    poly_sincos(r, ((sin_a && !odd) || (cos_a && odd)) ? &sin_r : 0,
+                   ((sin_a && odd) || (cos_a && !odd)) ? &cos_r : 0, status);
+    if (sin_a) *sin_a = sincos_approximation(zSign, sin_r, cos_r, q, status);
+    if (cos_a) *cos_a = sincos_approximation(zSign, sin_r, cos_r, q + 1, status);
 
     return 0;
 }
@@ -6538,6 +7888,8 @@ int ftan(floatx80 *a_input, float_status_t *status) {
             return 0;
         }
         zExp = aExp;
+    } else if (expDiff == -1 && aSig0 <= FLOAT_PI_HI) {    // |a| < pi/4 doesn't either
+        zExp = aExp;
     } else {
         q = reduce_trig_arg(expDiff, &zSign, &aSig0, &aSig1);
     }
@@ -6549,14 +7901,20 @@ int ftan(floatx80 *a_input, float_status_t *status) {
     /* using float128 for approximation */
     float128 r = normalizeRoundAndPackFloat128(0, zExp - 0x10, aSig0, aSig1, status);
 
-    float128 sin_r = poly_sin(r, status);
-    float128 cos_r = poly_cos(r, status);
+    if (q & 0x1) zSign = !zSign;
 
-    if (q & 0x1) {
-        r = float128_div(cos_r, sin_r, status);
-        zSign = !zSign;
-    } else {
-        r = float128_div(sin_r, cos_r, status);
+#ifdef LIBX87_TABLE_KERNELS
+    if (!tan_table_approximation(r, q & 0x1, &r))
+#endif
+    {
+        float128 sin_r = poly_sin(r, status);
+        float128 cos_r = poly_cos(r, status);
+
+        if (q & 0x1) {
+            r = float128_div(cos_r, sin_r, status);
+        } else {
+            r = float128_div(sin_r, cos_r, status);
+        }
     }
 
     a = float128_to_floatx80(r, status);
@@ -6599,10 +7957,15 @@ these four paragraphs for those parts of this code that are retained.
 
 /* executes single exponent reduction cycle */
     static uint64_t remainder_kernel(uint64_t aSig0, uint64_t bSig, int expDiff, uint64_t *zSig0, uint64_t *zSig1) {
-        uint64_t term0, term1;
         uint64_t aSig1 = 0;
 
         shortShift128Left(aSig1, aSig0, expDiff, &aSig1, &aSig0);
+#ifdef LIBX87_HW_DIVIDE
+        // expDiff < 64 keeps aSig1 below bSig, so the quotient cannot overflow
+        *zSig1 = 0;
+        return div128By64To64(aSig1, aSig0, bSig, zSig0);
+#else
+        uint64_t term0, term1;
         uint64_t q = estimateDiv128To64(aSig1, aSig0, bSig);
         mul64To128(bSig, q, &term0, &term1);
         sub128(aSig1, aSig0, term0, term1, zSig1, zSig0);
@@ -6611,6 +7974,7 @@ these four paragraphs for those parts of this code that are retained.
             add128(*zSig1, *zSig0, 0, bSig, zSig1, zSig0);
         }
         return q;
+#endif
     }
 
     static int
@@ -6776,6 +8140,60 @@ these four paragraphs for those parts of this code that are retained.
         return do_fprem(a, b, r, q, float_round_to_zero, status);
     }
 
+/*----------------------------------------------------------------------------
+| Unpacks the divisor `b' of a partial remainder reduction into `d' for
+| `floatx80_remainder_partial'.  Returns 0 if `b' is not a normal number,
+| in which case the reduction has to go through the full operation.
+*----------------------------------------------------------------------------*/
+
+    int floatx80_remainder_divisor_init(floatx80 b, floatx80_remainder_divisor *d) {
+        int32_t bExp = extractFloatx80Exp(b);
+        uint64_t bSig = extractFloatx80Frac(b);
+
+        if (bExp == 0 || bExp == 0x7FFF || !(bSig & U64(0x8000000000000000))) return 0;
+        d->sig = bSig;
+        d->exp = bExp;
+#ifdef LIBX87_NATIVE_INT128
+        d->recip = reciprocal64(bSig);
+#else
+        d->recip = 0;
+#endif
+        return 1;
+    }
+
+/*----------------------------------------------------------------------------
+| Performs one partial reduction step of FPREM or FPREM1 of `a' by the
+| divisor `d', which the two share as long as the exponent of `a' exceeds
+| that of the divisor by 64 or more.  Such a step is exact, so if `a' is a
+| normal number and the partial remainder is as well, it is stored in `r'
+| and 1 is returned, without raising any flag.  Returns 0, leaving `r'
+| alone, in every other case; the full operation must then be used.
+*----------------------------------------------------------------------------*/
+
+    int floatx80_remainder_partial(floatx80 a, const floatx80_remainder_divisor *d, floatx80 *r) {
+        int32_t aExp = extractFloatx80Exp(a);
+        uint64_t aSig = extractFloatx80Frac(a);
+        uint64_t zSig;
+
+        if (aExp == 0 || aExp == 0x7FFF || !(aSig & U64(0x8000000000000000))) return 0;
+        int32_t expDiff = aExp - d->exp;
+        if (expDiff < 64) return 0;
+
+        int n = (expDiff & 0x1f) | 0x20;
+#ifdef LIBX87_NATIVE_INT128
+        div128By64To64Reciprocal(aSig >> (64 - n), aSig << n, d->sig, d->recip, &zSig);
+#else
+        uint64_t zSig1;
+        remainder_kernel(aSig, d->sig, n, &zSig, &zSig1);
+#endif
+        if (zSig == 0) return 0;
+        int shiftCount = countLeadingZeros64(zSig);
+        int32_t zExp = aExp - n - shiftCount;
+        if (zExp <= 0) return 0;
+        *r = packFloatx80(extractFloatx80Sign(a), zExp, zSig << shiftCount);
+        return 1;
+    }
+
 /*============================================================================
 This source file is an extension to the SoftFloat IEC/IEEE Floating-point
 Arithmetic Package, Release 2b, written for Bochs (x86 achitecture simulator)
@@ -6803,7 +8221,6 @@ these four paragraphs for those parts of this code that are retained.
 
 #define FLOAT128
 
-#define FPATAN_ARR_SIZE 11
 
     static const float128 float128_sqrt3 =
             packFloat128Constant(U64(0x3fffbb67ae8584ca), U64(0xa73b25742d7078b8));
@@ -6817,22 +8234,8 @@ these four paragraphs for those parts of this code that are retained.
     static const float128 float128_pi6 =
             packFloat128Constant(U64(0x3ffe0c152382d736), U64(0x58465BB32E0F580F));
 
-    static float128 atan_arr[FPATAN_ARR_SIZE] =
-            {
-                    PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
-                    PACK_FLOAT_128(0xbffd555555555555, 0x5555555555555555), /*  3 */
-                    PACK_FLOAT_128(0x3ffc999999999999, 0x999999999999999a), /*  5 */
-                    PACK_FLOAT_128(0xbffc249249249249, 0x2492492492492492), /*  7 */
-                    PACK_FLOAT_128(0x3ffbc71c71c71c71, 0xc71c71c71c71c71c), /*  9 */
-                    PACK_FLOAT_128(0xbffb745d1745d174, 0x5d1745d1745d1746), /* 11 */
-                    PACK_FLOAT_128(0x3ffb3b13b13b13b1, 0x3b13b13b13b13b14), /* 13 */
-                    PACK_FLOAT_128(0xbffb111111111111, 0x1111111111111111), /* 15 */
-                    PACK_FLOAT_128(0x3ffae1e1e1e1e1e1, 0xe1e1e1e1e1e1e1e2), /* 17 */
-                    PACK_FLOAT_128(0xbffaaf286bca1af2, 0x86bca1af286bca1b), /* 19 */
-                    PACK_FLOAT_128(0x3ffa861861861861, 0x8618618618618618)  /* 21 */
-            };
 
-    extern float128 OddPoly(float128 x, float128 *arr, int n, float_status_t *status);
+    extern float128 OddPoly(float128 x, const float128 *arr, int n, float_status_t *status);
 
 /* |x| < 1/4 */
     static float128 poly_atan(float128 x1, float_status_t *status) {
@@ -6860,6 +8263,137 @@ these four paragraphs for those parts of this code that are retained.
         return OddPoly(x1, atan_arr, FPATAN_ARR_SIZE, status);
     }
 
+#ifdef LIBX87_TABLE_KERNELS
+
+/*----------------------------------------------------------------------------
+| Breakpoint-table arctangent of the ratio x = s/l of two significands with
+| s < l.  With c = i/64 the breakpoint nearest to x,
+|
+|                                 s - c*l
+|     atan(x) = atan(c) + atan(t),  t = ---------,  |t| <= 1/128
+|                                 l + c*s
+|
+| where numerator and denominator are exact in Q4.124 and the reciprocal of
+| the denominator comes from three Newton steps after a 64-bit division.
+| atan(t) = t * p(t^2) with an eight-term polynomial p, whose truncation
+| error is below 2^-116.  For i = 0, t = x and the result is the
+| floating-point product s * (1/l) * p(t^2), so that small ratios keep their
+| relative precision.  The exponent of `s' must be at most 40 below that
+| of `l'.
+*----------------------------------------------------------------------------*/
+
+#define ATAN_TABLE_STEP_BITS 6
+
+    // atan(i/64) in Q4.124, i = 0..64
+    static const uint64_t atan_table[(1 << ATAN_TABLE_STEP_BITS) + 1][2] =
+            {
+                    {U64(0x0000000000000000), U64(0x0000000000000000)}, /* atan(0/64) */
+                    {U64(0x003ffeaab776e535), U64(0x6ef9e31590057dd8)}, /* atan(1/64) */
+                    {U64(0x007ff556eea5d892), U64(0xa13bcebbb6ed4631)}, /* atan(2/64) */
+                    {U64(0x00bfdc0c2186d14f), U64(0xcf220e10d61df56f)}, /* atan(3/64) */
+                    {U64(0x00ffaaddb967ef4e), U64(0x36cb2792dc0e2e0d)}, /* atan(4/64) */
+                    {U64(0x013f59f0e7c559d6), U64(0xb1338a177e11cd9c)}, /* atan(5/64) */
+                    {U64(0x017ee182602f10e8), U64(0xc126acfcf099f06d)}, /* atan(6/64) */
+                    {U64(0x01be39ebe6f07c37), U64(0xdee3ca681661cbb4)}, /* atan(7/64) */
+                    {U64(0x01fd5ba9aac2f6dc), U64(0x65912f313e7d111e)}, /* atan(8/64) */
+                    {U64(0x023c3f5f6086e4dc), U64(0x96f4dd64a60e82be)}, /* atan(9/64) */
+                    {U64(0x027adddd18cc4d8b), U64(0x0d1d8674940d83fa)}, /* atan(10/64) */
+                    {U64(0x02b93023c7d84d3b), U64(0xead534ffbc30b7a6)}, /* atan(11/64) */
+                    {U64(0x02f72f6979cb6044), U64(0xd1ec2d3e207271d2)}, /* atan(12/64) */
+                    {U64(0x0334d51d2d90c4c3), U64(0x9ec03cf68691bbad)}, /* atan(13/64) */
+                    {U64(0x03721aea524c1440), U64(0x8bd88697072d54bc)}, /* atan(14/64) */
+                    {U64(0x03aefabbe40ae6ce), U64(0x32468a9a2cbef5e4)}, /* atan(15/64) */
+                    {U64(0x03eb6ebf25901bac), U64(0x55b71e7bd7de8860)}, /* atan(16/64) */
+                    {U64(0x04277165f618d896), U64(0x2e47390cb8655e9d)}, /* atan(17/64) */
+                    {U64(0x0462fd68c2fc5e09), U64(0x86523a458dfc414c)}, /* atan(18/64) */
+                    {U64(0x049e0dc815fbd16f), U64(0x88322c92037f0a24)}, /* atan(19/64) */
+                    {U64(0x04d89dcdc1faf2f3), U64(0x4e2d5da4c693d799)}, /* atan(20/64) */
+                    {U64(0x0512a90db0abc26a), U64(0x2a1bc3aa4c45c6cf)}, /* atan(21/64) */
+                    {U64(0x054c2b6654735276), U64(0xd4cdbfbbdfbecf46)}, /* atan(22/64) */
+                    {U64(0x05852100c273f865), U64(0x8da8ea8ee100507e)}, /* atan(23/64) */
+                    {U64(0x05bd86507937bc23), U64(0x9c55190916e7f224)}, /* atan(24/64) */
+                    {U64(0x05f55812d8ecfdd6), U64(0x9c885c2b249a0881)}, /* atan(25/64) */
+                    {U64(0x062c934e5286c95b), U64(0x6d0ba3748fa85147)}, /* atan(26/64) */
+                    {U64(0x06633551535ac619), U64(0xe6c988fd0a76cdbe)}, /* atan(27/64) */
+                    {U64(0x06993bb0f308ff2d), U64(0xb213e4af4800f38a)}, /* atan(28/64) */
+                    {U64(0x06cea44769971b1a), U64(0xe187b1ca504031a3)}, /* atan(29/64) */
+                    {U64(0x07036d3253b27be3), U64(0x3e318f6cb3cc65c0)}, /* atan(30/64) */
+                    {U64(0x073794d0cb04d425), U64(0xd305bbe70e536e16)}, /* atan(31/64) */
+                    {U64(0x076b19c1586ed3da), U64(0x2b7f222f65e1d468)}, /* atan(32/64) */
+                    {U64(0x079dfadfc5d68d10), U64(0xe53dc1bf34356fa0)}, /* atan(33/64) */
+                    {U64(0x07d03742d50505f2), U64(0xe33691e3eaee4766)}, /* atan(34/64) */
+                    {U64(0x0801ce39e0d205c9), U64(0x9a6d6c6c54d93859)}, /* atan(35/64) */
+                    {U64(0x0832bf4a6d9867e2), U64(0xa4b6a09cb61a515c)}, /* atan(36/64) */
+                    {U64(0x08630a2dada1ed06), U64(0x5d3e84ed5013ca38)}, /* atan(37/64) */
+                    {U64(0x0892aecdfde9547b), U64(0x5094478fc472b4b0)}, /* atan(38/64) */
+                    {U64(0x08c1ad445f3e09b8), U64(0xc439d80186020592)}, /* atan(39/64) */
+                    {U64(0x08f005d5ef7f59f9), U64(0xb5c835e1665c4374)}, /* atan(40/64) */
+                    {U64(0x091db8f1664f350e), U64(0x210e4f9c1126e022)}, /* atan(41/64) */
+                    {U64(0x094ac72c9847186f), U64(0x618c4f393f78a330)}, /* atan(42/64) */
+                    {U64(0x097731420365e538), U64(0xbabd3fe19f1aeb6b)}, /* atan(43/64) */
+                    {U64(0x09a2f80e671bdda2), U64(0x04226f8e2204ff3c)}, /* atan(44/64) */
+                    {U64(0x09ce1c8e6a0b8cdb), U64(0x9f799c4e8174cf12)}, /* atan(45/64) */
+                    {U64(0x09f89fdc4f4b7a1e), U64(0xcf8b492644f0701e)}, /* atan(46/64) */
+                    {U64(0x0a22832dbcadaae0), U64(0x892fe9c08637af0e)}, /* atan(47/64) */
+                    {U64(0x0a4bc7d1934f7092), U64(0x419a87f2a457daca)}, /* atan(48/64) */
+                    {U64(0x0a746f2ddb760229), U64(0x467b7d66f2d74e02)}, /* atan(49/64) */
+                    {U64(0x0a9c7abdc4830f5c), U64(0x8916a84b5be7933f)}, /* atan(50/64) */
+                    {U64(0x0ac3ec0fb997dd6a), U64(0x1a36273a56afa8ef)}, /* atan(51/64) */
+                    {U64(0x0aeac4c38b4d8c08), U64(0x014725e2f3e52071)}, /* atan(52/64) */
+                    {U64(0x0b110688aebdc6f6), U64(0xa43d65788b9f6a7b)}, /* atan(53/64) */
+                    {U64(0x0b36b31c91f04369), U64(0x1590141744462f94)}, /* atan(54/64) */
+                    {U64(0x0b5bcc49059ecc4a), U64(0xff8f3cee75e3907d)}, /* atan(55/64) */
+                    {U64(0x0b8053e2bc2319e7), U64(0x3cb2da55210a4444)}, /* atan(56/64) */
+                    {U64(0x0ba44bc7dd470782), U64(0xf654c2cb10942e38)}, /* atan(57/64) */
+                    {U64(0x0bc7b5deae98af28), U64(0x0d4113006e80fb29)}, /* atan(58/64) */
+                    {U64(0x0bea94144fd049aa), U64(0xc1043c5e755282e8)}, /* atan(59/64) */
+                    {U64(0x0c0ce85b8ac52664), U64(0x089dd62c46e92fa2)}, /* atan(60/64) */
+                    {U64(0x0c2eb4abb661628b), U64(0x5b373fe45c61bba0)}, /* atan(61/64) */
+                    {U64(0x0c4ffaffabf8fbd5), U64(0x48cb43d10bc9e022)}, /* atan(62/64) */
+                    {U64(0x0c70bd54ce602ee1), U64(0x3e7d54fbd09f2be4)}, /* atan(63/64) */
+                    {U64(0x0c90fdaa22168c23), U64(0x4c4c6628b80dc1cd)}  /* atan(64/64) */
+            };
+
+
+    static float128 atan_ratio_approximation(uint64_t sSig, int32_t sExp, uint64_t lSig, int32_t lExp) {
+        const int128_native one = (int128_native) 1 << FLOAT128_FIXED_FRAC_BITS;
+        int expDiff = lExp - sExp;
+        float128_unpacked uz, up;
+
+        // nearest breakpoint from 64-bit division
+        int i = (int) (((sSig >> 1 >> expDiff) / (lSig >> (ATAN_TABLE_STEP_BITS + 2)) + 1) >> 1);
+
+        int128_native l = (int128_native) lSig << (FLOAT128_FIXED_FRAC_BITS - 63);
+        int128_native s = ((int128_native) sSig << (FLOAT128_FIXED_FRAC_BITS - 63)) >> expDiff;
+        int128_native num = s - (l >> ATAN_TABLE_STEP_BITS) * i;
+        int128_native den = l + (s >> ATAN_TABLE_STEP_BITS) * i;
+
+        // 1/den: 30-bit estimate, then three Newton steps
+        uint64_t denHi = (uint64_t) (den >> (FLOAT128_FIXED_FRAC_BITS - 31));
+        int128_native r = (int128_native) ((U64(1) << 63) / denHi) << (FLOAT128_FIXED_FRAC_BITS - 32);
+        for (int n = 0; n < 3; n++)
+            r += mulFixed(r, one - mulFixed(den, r));
+
+        int128_native t = mulFixed(num, r);
+        int128_native u = mulFixed(t, t);
+        int128_native p = EvalPolyFixedEstrin(u, atan_poly_fixed, ATAN_POLY_SIZE);
+
+        if (i == 0) {
+            uz.sign = 0;
+            uz.exp = 0x3FFF - expDiff;
+            uz.sig = (uint128_native) sSig << 49;
+            normalizeFixedToFloat128Unpacked(r, &up);
+            mulFloat128Unpacked(uz, up, &uz);
+            normalizeFixedToFloat128Unpacked(p, &up);
+            mulFloat128Unpacked(uz, up, &uz);
+        } else {
+            normalizeFixedToFloat128Unpacked((int128_native) pack128(atan_table[i][0], atan_table[i][1]) + mulFixed(t, p), &uz);
+        }
+        return packFloat128Unpacked(uz);
+    }
+
+#endif
+
 // =================================================
 // FPATAN                  Compute y * log (x)
 //                                        2
@@ -6989,16 +8523,29 @@ these four paragraphs for those parts of this code that are retained.
         float128 a128 = normalizeRoundAndPackFloat128(0, aExp - 0x10, aSig, 0, status);
         float128 b128 = normalizeRoundAndPackFloat128(0, bExp - 0x10, bSig, 0, status);
         float128 x;
+        int32_t xExp;
         int swap = 0, add_pi6 = 0, add_pi4 = 0;
 
         if (aExp > bExp || (aExp == bExp && aSig > bSig)) {
+#ifdef LIBX87_TABLE_KERNELS
+            if (aExp - bExp < 40) {
+                x = atan_ratio_approximation(bSig, bExp, aSig, aExp);
+                goto approximation_completed;
+            }
+#endif
             x = float128_div(b128, a128, status);
         } else {
-            x = float128_div(a128, b128, status);
             swap = 1;
+#ifdef LIBX87_TABLE_KERNELS
+            if (bExp - aExp < 40) {
+                x = atan_ratio_approximation(aSig, aExp, bSig, bExp);
+                goto approximation_completed;
+            }
+#endif
+            x = float128_div(a128, b128, status);
         }
 
-        int32_t xExp = extractFloat128Exp(x);
+        xExp = extractFloat128Exp(x);
 
         if (xExp <= FLOATX80_EXP_BIAS - 40)
             goto approximation_completed;
@@ -7087,28 +8634,9 @@ these four paragraphs for those parts of this code that are retained.
 
 #endif
 
-#define EXP_ARR_SIZE 15
 
-    static float128 exp_arr[EXP_ARR_SIZE] =
-            {
-                    PACK_FLOAT_128(0x3fff000000000000, 0x0000000000000000), /*  1 */
-                    PACK_FLOAT_128(0x3ffe000000000000, 0x0000000000000000), /*  2 */
-                    PACK_FLOAT_128(0x3ffc555555555555, 0x5555555555555555), /*  3 */
-                    PACK_FLOAT_128(0x3ffa555555555555, 0x5555555555555555), /*  4 */
-                    PACK_FLOAT_128(0x3ff8111111111111, 0x1111111111111111), /*  5 */
-                    PACK_FLOAT_128(0x3ff56c16c16c16c1, 0x6c16c16c16c16c17), /*  6 */
-                    PACK_FLOAT_128(0x3ff2a01a01a01a01, 0xa01a01a01a01a01a), /*  7 */
-                    PACK_FLOAT_128(0x3fefa01a01a01a01, 0xa01a01a01a01a01a), /*  8 */
-                    PACK_FLOAT_128(0x3fec71de3a556c73, 0x38faac1c88e50017), /*  9 */
-                    PACK_FLOAT_128(0x3fe927e4fb7789f5, 0xc72ef016d3ea6679), /* 10 */
-                    PACK_FLOAT_128(0x3fe5ae64567f544e, 0x38fe747e4b837dc7), /* 11 */
-                    PACK_FLOAT_128(0x3fe21eed8eff8d89, 0x7b544da987acfe85), /* 12 */
-                    PACK_FLOAT_128(0x3fde6124613a86d0, 0x97ca38331d23af68), /* 13 */
-                    PACK_FLOAT_128(0x3fda93974a8c07c9, 0xd20badf145dfa3e5), /* 14 */
-                    PACK_FLOAT_128(0x3fd6ae7f3e733b81, 0xf11d8656b0ee8cb0)  /* 15 */
-            };
 
-    extern float128 EvalPoly(float128 x, float128 *arr, int n, float_status_t *status);
+    extern float128 EvalPoly(float128 x, const float128 *arr, int n, float_status_t *status);
 
 /* required -1 < x < 1 */
     static float128 poly_exp(float128 x, float_status_t *status) {
@@ -7137,6 +8665,137 @@ these four paragraphs for those parts of this code that are retained.
         return float128_mul(t, x, status);
     }
 
+#ifdef LIBX87_TABLE_KERNELS
+
+/*----------------------------------------------------------------------------
+| Table-driven 2^x - 1 for 2^-68 <= |x| < 1.  `x' is split into the nearest
+| multiple i/64 and a remainder |f| <= 1/128, and
+|
+|      x          i/64    f*ln(2)       i/64
+|     2  - 1 = 2      * (e        - 1) + (2     - 1)
+|
+| where e^t - 1 = t * p(t) with a twelve-term Taylor polynomial p, whose
+| truncation error is below 2^-120.  The sum is formed in Q4.124 (see
+| `EvalPolyFixed'); for i = 0 the result is the floating-point product
+| x * ln(2) * p(t), so that small arguments keep their relative precision.
+*----------------------------------------------------------------------------*/
+
+#define EXP2_TABLE_STEP_BITS 6
+
+    static const uint64_t fixed_ln2[2] = { U64(0x0b17217f7d1cf79a), U64(0xbc9e3b39803f2f6b) };
+
+    // 2^(j/64) in Q4.124, j = 0..63
+    static const uint64_t exp2_table[1 << EXP2_TABLE_STEP_BITS][2] =
+            {
+                    {U64(0x1000000000000000), U64(0x0000000000000000)}, /* 2^(0/64) */
+                    {U64(0x102c9a3e778060ee), U64(0x6f7caca4f7a29bdf)}, /* 2^(1/64) */
+                    {U64(0x1059b0d31585743a), U64(0xe7c548eb68ca4180)}, /* 2^(2/64) */
+                    {U64(0x10874518759bc808), U64(0xc35f25d9427fa2b0)}, /* 2^(3/64) */
+                    {U64(0x10b5586cf9890f62), U64(0x98b92b71842a9836)}, /* 2^(4/64) */
+                    {U64(0x10e3ec32d3d1a202), U64(0x0742e4f8af6a552b)}, /* 2^(5/64) */
+                    {U64(0x111301d0125b50a4), U64(0xebbf1aed9318ceac)}, /* 2^(6/64) */
+                    {U64(0x11429aaea92ddfb3), U64(0x4101943b2586d018)}, /* 2^(7/64) */
+                    {U64(0x1172b83c7d517adc), U64(0xdf7c8c50eb14a792)}, /* 2^(8/64) */
+                    {U64(0x11a35beb6fcb753c), U64(0xb698f692d1c835a7)}, /* 2^(9/64) */
+                    {U64(0x11d4873168b9aa78), U64(0x05b8028990f07a99)}, /* 2^(10/64) */
+                    {U64(0x12063b88628cd63b), U64(0x8eeb02950929d0fc)}, /* 2^(11/64) */
+                    {U64(0x12387a6e75623866), U64(0xc1fadb1c15cb593b)}, /* 2^(12/64) */
+                    {U64(0x126b4565e27cdd25), U64(0x7a673281d3b249dd)}, /* 2^(13/64) */
+                    {U64(0x129e9df51fdee12c), U64(0x25d15f5a24aa3bcb)}, /* 2^(14/64) */
+                    {U64(0x12d285a6e4030b40), U64(0x091d536d07538459)}, /* 2^(15/64) */
+                    {U64(0x1306fe0a31b7152d), U64(0xe8d5a46305c85edf)}, /* 2^(16/64) */
+                    {U64(0x133c08b26416ff4c), U64(0x9c8610d96696bf96)}, /* 2^(17/64) */
+                    {U64(0x1371a7373aa9caa7), U64(0x145502f4547987e4)}, /* 2^(18/64) */
+                    {U64(0x13a7db34e59ff6ea), U64(0x1bc9299e0a1d3361)}, /* 2^(19/64) */
+                    {U64(0x13dea64c12342235), U64(0xb41223e13d773fba)}, /* 2^(20/64) */
+                    {U64(0x14160a21f72e29f8), U64(0x4325b8f3db61fb35)}, /* 2^(21/64) */
+                    {U64(0x144e086061892d03), U64(0x136f409df019fbd5)}, /* 2^(22/64) */
+                    {U64(0x1486a2b5c13cd013), U64(0xc1a3b69062f03c3e)}, /* 2^(23/64) */
+                    {U64(0x14bfdad5362a271d), U64(0x4397afec42e20e03)}, /* 2^(24/64) */
+                    {U64(0x14f9b2769d2ca6ad), U64(0x33d8b69aa073ee56)}, /* 2^(25/64) */
+                    {U64(0x15342b569d4f81df), U64(0x0a83c49d86a63f4e)}, /* 2^(26/64) */
+                    {U64(0x156f4736b527da66), U64(0xecb004764eb3c00f)}, /* 2^(27/64) */
+                    {U64(0x15ab07dd48542958), U64(0xc93015191eb345d9)}, /* 2^(28/64) */
+                    {U64(0x15e76f15ad21486e), U64(0x9be4c20399766a06)}, /* 2^(29/64) */
+                    {U64(0x16247eb03a5584b1), U64(0xf0fa06fd2da42bb2)}, /* 2^(30/64) */
+                    {U64(0x1662388255222491), U64(0x27d9e29b8f314a33)}, /* 2^(31/64) */
+                    {U64(0x16a09e667f3bcc90), U64(0x8b2fb1366ea957d4)}, /* 2^(32/64) */
+                    {U64(0x16dfb23c651a2ef2), U64(0x20e2cbe1bbaa834b)}, /* 2^(33/64) */
+                    {U64(0x171f75e8ec5f73dd), U64(0x2370f2ef0acd6cb4)}, /* 2^(34/64) */
+                    {U64(0x175feb564267c8bf), U64(0x6e9aa33a48b27072)}, /* 2^(35/64) */
+                    {U64(0x17a11473eb0186d7), U64(0xd51023f6cda1f5ef)}, /* 2^(36/64) */
+                    {U64(0x17e2f336cf4e6210), U64(0x5d02ba15797e170a)}, /* 2^(37/64) */
+                    {U64(0x182589994cce128a), U64(0xcf88afab34a010f7)}, /* 2^(38/64) */
+                    {U64(0x1868d99b4492ec80), U64(0xe41d90ac25170748)}, /* 2^(39/64) */
+                    {U64(0x18ace5422aa0db5b), U64(0xa7c55a192c9bb3e7)}, /* 2^(40/64) */
+                    {U64(0x18f1ae991577362b), U64(0x982745c72ed804f0)}, /* 2^(41/64) */
+                    {U64(0x193737b0cdc5e4f4), U64(0x501c3f2540a22d30)}, /* 2^(42/64) */
+                    {U64(0x197d829fde4e4f8b), U64(0x9e920f91e8bd7edc)}, /* 2^(43/64) */
+                    {U64(0x19c49182a3f0901c), U64(0x7c46b071f2be58de)}, /* 2^(44/64) */
+                    {U64(0x1a0c667b5de564b2), U64(0x9ada8b8cab349aa0)}, /* 2^(45/64) */
+                    {U64(0x1a5503b23e255c8b), U64(0x424491caf87bc805)}, /* 2^(46/64) */
+                    {U64(0x1a9e6b5579fdbf43), U64(0xeb243bdff4c4c58b)}, /* 2^(47/64) */
+                    {U64(0x1ae89f995ad3ad5e), U64(0x8734d1773205a7fc)}, /* 2^(48/64) */
+                    {U64(0x1b33a2b84f15faf6), U64(0xbfd0e7bd947c2575)}, /* 2^(49/64) */
+                    {U64(0x1b7f76f2fb5e46ea), U64(0xa7b081ab53c5354d)}, /* 2^(50/64) */
+                    {U64(0x1bcc1e904bc1d224), U64(0x7ba0f45b3d08cd0b)}, /* 2^(51/64) */
+                    {U64(0x1c199bdd85529c22), U64(0x20cb12a091ba6679)}, /* 2^(52/64) */
+                    {U64(0x1c67f12e57d14b4a), U64(0x2137fd20f2b301de)}, /* 2^(53/64) */
+                    {U64(0x1cb720dcef906915), U64(0x03cbd1e949db761e)}, /* 2^(54/64) */
+                    {U64(0x1d072d4a07897b8d), U64(0x0f22f21a158e18fc)}, /* 2^(55/64) */
+                    {U64(0x1d5818dcfba48725), U64(0xda05aeb66e0dca9f)}, /* 2^(56/64) */
+                    {U64(0x1da9e603db328570), U64(0x8c01a5b6d4c97f62)}, /* 2^(57/64) */
+                    {U64(0x1dfc97337b9b5eb9), U64(0x68cac39ed291b722)}, /* 2^(58/64) */
+                    {U64(0x1e502ee78b3ff627), U64(0x3d130153991e8f49)}, /* 2^(59/64) */
+                    {U64(0x1ea4afa2a490d985), U64(0x8f73a18f5db301f8)}, /* 2^(60/64) */
+                    {U64(0x1efa1bee615a2777), U64(0x1fd21a92dac1f6dd)}, /* 2^(61/64) */
+                    {U64(0x1f50765b6e454067), U64(0x4f84b762862baffa)}, /* 2^(62/64) */
+                    {U64(0x1fa7c1819e90d82e), U64(0x90a7e74b263c1dc0)}  /* 2^(63/64) */
+            };
+
+
+    static int exp2m1_table_approximation(int aSign, int32_t aExp, uint64_t aSig, float128 *z) {
+        const int stepShift = FLOAT128_FIXED_FRAC_BITS - EXP2_TABLE_STEP_BITS;
+        const int128_native one = (int128_native) 1 << FLOAT128_FIXED_FRAC_BITS;
+        float128_unpacked ux, uz;
+
+        // |x| in Q4.124, truncated below 2^-124 where only p(t) uses it
+        int shiftCount = FLOAT128_FIXED_FRAC_BITS - 63 + aExp - 0x3FFF;
+        int128_native x = (shiftCount >= 0) ? (int128_native) aSig << shiftCount : (int128_native) (aSig >> -shiftCount);
+        if (aSign) x = -x;
+
+        int i = (int) ((x + ((int128_native) 1 << (stepShift - 1))) >> stepShift);
+        int128_native t = mulFixed(x - ((int128_native) i << stepShift), (int128_native) pack128(fixed_ln2[0], fixed_ln2[1]));
+
+        int128_native p = EvalPolyFixedEstrin(t, expm1_poly_fixed, EXP2_POLY_SIZE);
+
+        if (i == 0) {
+            ux.sign = aSign;
+            ux.exp = aExp;
+            ux.sig = (uint128_native) aSig << 49;
+            uz.sign = 0;
+            uz.exp = 0x3FFE;
+            uz.sig = pack128(extractFloat128Frac0(float128_ln2) | U64(0x0001000000000000), extractFloat128Frac1(float128_ln2));
+            mulFloat128Unpacked(ux, uz, &ux);
+            if (!fixedToFloat128Unpacked(p, &uz)) return 0;
+            mulFloat128Unpacked(ux, uz, &uz);
+            *z = packFloat128Unpacked(uz);
+            return 1;
+        }
+
+        // 2^(i/64) from 2^(j/64) with i = j + 64 * k, k = -1..1
+        int j = i & ((1 << EXP2_TABLE_STEP_BITS) - 1);
+        int128_native scale = (int128_native) pack128(exp2_table[j][0], exp2_table[j][1]);
+        if (i < 0) scale >>= 1;
+        else if (i == (1 << EXP2_TABLE_STEP_BITS)) scale <<= 1;
+
+        if (!fixedToFloat128Unpacked(scale - one + mulFixed(scale, mulFixed(t, p)), &uz)) return 0;
+        *z = packFloat128Unpacked(uz);
+        return 1;
+    }
+
+#endif
+
 // =================================================
 //                                  x
 // FX2M1                   Compute 2  - 1
@@ -7201,7 +8860,12 @@ these four paragraphs for those parts of this code that are retained.
             /* using float128 for approximation */
             /* ******************************** */
 
-            float128 x = floatx80_to_float128(a, status);
+            float128 x;
+#ifdef LIBX87_TABLE_KERNELS
+            if (exp2m1_table_approximation(aSign, aExp, aSig, &x))
+                return float128_to_floatx80(x, status);
+#endif
+            x = floatx80_to_float128(a, status);
             x = float128_mul(x, float128_ln2, status);
             x = poly_exp(x, status);
             return float128_to_floatx80(x, status);
@@ -0,0 +1,45 @@
+// Built once per division engine.  The build renames the libx87 namespace
+// and sets DIV_CHECK_ENTRY, so that every copy of softfloat can be linked
+// into the same program.
+
+#include "div-check.h"
+#include "softfloat.cpp"
+
+extern "C" void DIV_CHECK_ENTRY(const div_check_case *c, div_check_result *r)
+{
+    using namespace libx87;
+
+    floatx80 a, b, z;
+    a.fraction = c->a_fraction;
+    a.exp = c->a_exp;
+    b.fraction = c->b_fraction;
+    b.exp = c->b_exp;
+
+    float_status_t status = {};
+    status.float_rounding_precision = c->rounding_precision;
+    status.float_rounding_mode = c->rounding_mode;
+    status.float_exception_masks = c->exception_masks;
+    status.float_exception_flags = c->exception_flags;
+
+    z = floatx80_div(a, b, &status);
+    r->div_fraction = z.fraction;
+    r->div_exp = z.exp;
+    r->div_flags = status.float_exception_flags;
+
+    for (int ieee754 = 0; ieee754 < 2; ieee754++) {
+        status.float_exception_flags = c->exception_flags;
+        uint64_t q = 0;
+        r->rem_ret[ieee754] = ieee754 ? floatx80_ieee754_remainder(a, b, &z, &q, &status)
+                                      : floatx80_remainder(a, b, &z, &q, &status);
+        r->rem_fraction[ieee754] = z.fraction;
+        r->rem_exp[ieee754] = z.exp;
+        r->rem_quotient[ieee754] = q;
+        r->rem_flags[ieee754] = status.float_exception_flags;
+    }
+
+    status.float_exception_flags = c->exception_flags;
+    z = floatx80_sqrt(a, &status);
+    r->sqrt_fraction = z.fraction;
+    r->sqrt_exp = z.exp;
+    r->sqrt_flags = status.float_exception_flags;
+}
@@ -0,0 +1,133 @@
+// Compares FDIV, FPREM, FPREM1 and FSQRT across the division engines: the
+// default build (hardware 128/64 division and the fixed-point square root
+// where available), the portable estimate-and-correct code of
+// LIBX87_PORTABLE_ARITH and the reciprocal engine of LIBX87_DIV_NEWTON.  All
+// three must agree bit for bit on the result, the quotient bits and the
+// status flags.
+//
+// usage: div-check [cases] [seed]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <random>
+
+#include "div-check.h"
+
+static std::mt19937_64 rng;
+
+static uint64_t random_fraction()
+{
+    switch (rng() % 8) {
+        case 0:  return 0x8000000000000000ULL;
+        case 1:  return 0xFFFFFFFFFFFFFFFFULL;
+        case 2:  return 0x8000000000000000ULL | (1ULL << (rng() % 63));
+        case 3:  return 0xFFFFFFFFFFFFFFFFULL << (rng() % 64) | 0x8000000000000000ULL;
+        default: return rng() | 0x8000000000000000ULL;
+    }
+}
+
+static void random_operand(uint64_t *fraction, uint16_t *exp, uint16_t near_exp)
+{
+    uint16_t sign = (rng() & 1) << 15;
+    *fraction = random_fraction();
+    switch (rng() % 32) {
+        case 0:  *exp = 0;      *fraction >>= 1 + rng() % 63;        break; // denormal
+        case 1:  *exp = 0;      *fraction = 0;                       break; // zero
+        case 2:  *exp = 0x7FFF; *fraction = 0x8000000000000000ULL;   break; // infinity
+        case 3:  *exp = 0x7FFF; *fraction |= 1;                      break; // NaN
+        case 4:  *exp = 1 + rng() % 0x7FFE; *fraction >>= 1;         break; // unnormal
+        case 5:
+        case 6:  *exp = 1 + rng() % 0x7FFE;                          break;
+        case 7:  *exp = (rng() & 1) ? 1 + rng() % 80 : 0x7FFE - rng() % 80; break; // extremes
+        default: {
+            int e = near_exp + (int) (rng() % 160) - 80;
+            *exp = e < 1 ? 1 : e > 0x7FFE ? 0x7FFE : e;
+            break;
+        }
+    }
+    *exp |= sign;
+}
+
+static void random_case(div_check_case *c)
+{
+    static const int precisions[3] = { 32, 64, 80 };
+    static const int pending[4] = { 0, 0x01 /* invalid */, 0x10 /* underflow */, 0x08 /* overflow */ };
+
+    random_operand(&c->a_fraction, &c->a_exp, 0x3FFF);
+    random_operand(&c->b_fraction, &c->b_exp, c->a_exp & 0x7FFF);
+    if (rng() % 8 == 0) {
+        // divisor close to the dividend, where the quotient estimates overshoot
+        c->b_exp = c->a_exp;
+        c->b_fraction = c->a_fraction + (int) (rng() % 5) - 2;
+    }
+    c->rounding_precision = precisions[rng() % 3];
+    c->rounding_mode = rng() % 4;
+    c->exception_masks = (rng() & 1) ? 0x3F : (int) (rng() & 0x3F);
+    c->exception_flags = pending[rng() % 4];
+}
+
+static bool same_result(const div_check_result *x, const div_check_result *y)
+{
+    if (x->div_fraction != y->div_fraction || x->div_exp != y->div_exp || x->div_flags != y->div_flags)
+        return false;
+    for (int i = 0; i < 2; i++) {
+        if (x->rem_fraction[i] != y->rem_fraction[i] || x->rem_exp[i] != y->rem_exp[i]
+            || x->rem_quotient[i] != y->rem_quotient[i] || x->rem_flags[i] != y->rem_flags[i]
+            || x->rem_ret[i] != y->rem_ret[i])
+            return false;
+    }
+    return x->sqrt_fraction == y->sqrt_fraction && x->sqrt_exp == y->sqrt_exp && x->sqrt_flags == y->sqrt_flags;
+}
+
+static void print_result(const char *name, const div_check_result *r)
+{
+    printf("  %-9s div %04x:%016llx flags %04x", name, r->div_exp,
+        (unsigned long long) r->div_fraction, r->div_flags);
+    for (int i = 0; i < 2; i++)
+        printf(" | %s %d %04x:%016llx q %llx flags %04x", i ? "fprem1" : "fprem",
+            r->rem_ret[i], r->rem_exp[i], (unsigned long long) r->rem_fraction[i],
+            (unsigned long long) r->rem_quotient[i], r->rem_flags[i]);
+    printf(" | sqrt %04x:%016llx flags %04x\n", r->sqrt_exp,
+        (unsigned long long) r->sqrt_fraction, r->sqrt_flags);
+}
+
+int main(int argc, char **argv)
+{
+    static const struct {
+        const char *name;
+        div_check_fn fn;
+    } engines[3] = {
+        { "portable", div_check_portable },
+        { "default",  div_check_default  },
+        { "newton",   div_check_newton   },
+    };
+
+    long cases = argc > 1 ? atol(argv[1]) : 1000000;
+    rng.seed(argc > 2 ? strtoull(argv[2], NULL, 0) : 1);
+
+    long mismatches = 0;
+    for (long i = 0; i < cases; i++) {
+        div_check_case c;
+        div_check_result r[3];
+        random_case(&c);
+        for (int e = 0; e < 3; e++)
+            engines[e].fn(&c, &r[e]);
+
+        for (int e = 1; e < 3; e++) {
+            if (same_result(&r[0], &r[e])) continue;
+            if (mismatches++ < 10) {
+                printf("%s differs from %s for %04x:%016llx / %04x:%016llx"
+                       " (precision %d, rounding %d, masks %02x, flags %02x)\n",
+                    engines[e].name, engines[0].name,
+                    c.a_exp, (unsigned long long) c.a_fraction,
+                    c.b_exp, (unsigned long long) c.b_fraction,
+                    c.rounding_precision, c.rounding_mode, c.exception_masks, c.exception_flags);
+                print_result(engines[0].name, &r[0]);
+                print_result(engines[e].name, &r[e]);
+            }
+        }
+    }
+
+    printf("%ld cases, %ld mismatches\n", cases, mismatches);
+    return mismatches != 0;
+}
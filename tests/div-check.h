@@ -0,0 +1,41 @@
+#ifndef LIBX87_DIV_CHECK_H_
+#define LIBX87_DIV_CHECK_H_
+
+#include <stdint.h>
+
+// One operand pair and the status word state it is divided under
+struct div_check_case {
+    uint64_t a_fraction, b_fraction;
+    uint16_t a_exp, b_exp;
+    int rounding_precision;
+    int rounding_mode;
+    int exception_masks;
+    int exception_flags;
+};
+
+// Everything a division engine produces for a case: the FDIV result and
+// flags, the FPREM/FPREM1 remainders with their quotient bits, and the FSQRT
+// result and flags for the first operand
+struct div_check_result {
+    uint64_t div_fraction;
+    uint16_t div_exp;
+    int div_flags;
+    uint64_t rem_fraction[2];
+    uint16_t rem_exp[2];
+    uint64_t rem_quotient[2];
+    int rem_flags[2];
+    int rem_ret[2];
+    uint64_t sqrt_fraction;
+    uint16_t sqrt_exp;
+    int sqrt_flags;
+};
+
+typedef void (*div_check_fn)(const div_check_case *c, div_check_result *r);
+
+extern "C" {
+void div_check_default(const div_check_case *c, div_check_result *r);
+void div_check_portable(const div_check_case *c, div_check_result *r);
+void div_check_newton(const div_check_case *c, div_check_result *r);
+}
+
+#endif